@@ -1,9 +1,14 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
 #include "States/StateMachine.h"
 #include "States/MenuState.h"
 #include "Core/Constants.h"
+#include "UI/EventStatsOverlay.h"
 #include "Utils/ConfigLoader.h"
 #include "Managers/AudioManager.h"
 
@@ -25,8 +30,13 @@ public:
     void applySettingsChanges();             // Apply updated settings
     void loadInitialSettings();              // Load initial game settings
 
+    bool isStartupComplete() const;          // Every startup task has finished
+    void logStartupMilestone(const std::string& name); // Time since construction, logged once per name
+
 private:
-    void processEvents();                    // Handle window events
+    void processEvents();                    // Poll window events for the Input phase
+    void registerSystems();                  // Register global systems with the scheduler
+    void buildStartupPipeline();             // Declare startup tasks and their dependencies
     void update(float dt);                   // Update game logic
     void render();                           // Render the current state
     void calculateDeltaTime();               // Calculate frame delta time
@@ -41,7 +51,14 @@ private:
     float m_deltaTime = 0.0f;                 // Time between frames
     float m_accumulator = 0.0f;               // Time accumulator for fixed updates
 
-    bool m_isRunning = true;                 // Running state flag
+    std::atomic<bool> m_isRunning{ true };   // Running state flag
+
+    bool m_firstFrameShown = false;                  // Startup milestone logged
+
+    std::vector<sf::Event> m_inputEvents;            // Events for this frame's Input phase
+    std::vector<std::uint32_t> m_systemIds;          // Scheduler registrations owned by Game
+    std::unique_ptr<EventStatsOverlay> m_eventStatsOverlay; // Debug event tracing panel
+    std::unique_ptr<class StartupPipeline> m_startup;       // Startup task graph, pumped by the scheduler
 
     static constexpr float MAX_DELTA_TIME = 0.05f;    // Max delta to prevent large frame jumps
 };
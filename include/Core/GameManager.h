@@ -1,8 +1,11 @@
 ﻿#pragma once
 #include <memory>
+#include <cstdint>
 #include <SFML/Graphics.hpp>
 #include "Core/Constants.h"
 #include "Managers/EntityManager.h"
+#include "Systems/Subscription.h"
+#include <vector>
 
 class RobotManager;                      // Forward declarations
 class SquadMemberManager;
@@ -24,7 +27,8 @@ public:
     ~GameManager();                                      // Destructor
 
     void update(float dt);                               // Update game logic
-    void render(sf::RenderWindow& window);               // Render game elements
+    void render(sf::RenderTarget& window);               // Queue game entities for drawing
+    void renderHUD(sf::RenderTarget& window);            // Draw HUD on top of the flushed scene
     void handleEvent(const sf::Event& event);            // Handle window/game events
 
     void reset();                                        // Reset game state
@@ -68,6 +72,7 @@ public:
 
     void handleCoinDrop(const sf::Vector2f& position, int robotReward);    // Handle coin drop
     void handleHealthPackDrop(const sf::Vector2f& position);              // Handle health pack drop
+    void handleConfigReloaded();                                          // Push reloaded stats into live units
 
     float getElapsedTime() const;                        // Get elapsed game time
     int getScore() const;                                // Get current score
@@ -86,6 +91,8 @@ private:
     bool m_gameOver = false;                           // Is the game over
     bool m_victory = false;                            // Is it victory
     bool m_paused = false;                             // Is game paused
+    std::uint32_t m_physicsSystemId = 0;               // SystemScheduler registration for the physics step
+    std::vector<Subscription> m_subscriptions;         // Event handlers, removed with this manager
     float m_elapsedTime = 0.0f;                        // Elapsed time since start
 
     int m_currentLevel = 1;                            // Current game level
@@ -2,13 +2,14 @@
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
 #include "Core/Constants.h"
+#include "Systems/AnimationHandle.h"
 
 class GameObject {
 public:
     virtual ~GameObject();                               // Virtual destructor
 
     virtual void update(float dt) = 0;                   // Update object logic
-    virtual void draw(sf::RenderWindow& window) const = 0;  // Draw object
+    virtual void draw(sf::RenderTarget& window) const = 0;  // Draw object
     virtual GameTypes::ObjectCategory getObjectCategory() const = 0; // Get object category
 
     virtual void createPhysicsBody(b2World* world) = 0;  // Create physics body
@@ -29,6 +30,7 @@ protected:
     sf::Vector2f m_position{ 0.0f, 0.0f };                // Object position
     bool m_active = true;                                // Is object active
     b2Body* m_physicsBody = nullptr;                     // Physics body pointer
+    AnimationHandle m_animationHandle;                   // Component in AnimationSystem, if registered
 
     void setupCollisionFilters(b2FixtureDef& fixtureDef) const; // Set collision filters
 
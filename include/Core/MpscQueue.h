@@ -0,0 +1,62 @@
+// ================================
+// include/Core/MpscQueue.h - Lock-free intrusive multi-producer / single-consumer queue
+// ================================
+#pragma once
+#include <atomic>
+
+// Nodes are owned by the caller; derive from MpscNode to make a type queueable
+struct MpscNode {
+    std::atomic<MpscNode*> next{ nullptr };
+};
+
+// Vyukov-style queue: push() is one atomic exchange plus a store and may run
+// on any thread; pop() must only be called from the single consumer thread.
+// pop() can briefly report empty while a producer is between its two steps;
+// that node is returned by a later pop().
+class MpscQueue {
+public:
+    MpscQueue() : m_head(&m_stub), m_tail(&m_stub) {}
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void push(MpscNode* node) {                          // Any thread
+        node->next.store(nullptr, std::memory_order_relaxed);
+        MpscNode* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    MpscNode* pop() {                                    // Consumer thread only; nullptr if empty
+        MpscNode* tail = m_tail;
+        MpscNode* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub) {
+            if (!next) return nullptr;
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+
+        if (tail != m_head.load(std::memory_order_acquire)) {
+            return nullptr;                              // A push is half done
+        }
+
+        // Last real node: park the stub behind it so it can be handed out
+        push(&m_stub);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+private:
+    std::atomic<MpscNode*> m_head;                       // Producers append here
+    MpscNode* m_tail;                                    // Consumer reads from here
+    MpscNode m_stub;
+};
@@ -0,0 +1,60 @@
+// ================================
+// include/Core/StartupPipeline.h - Dependency-ordered startup jobs across threads
+// ================================
+#pragma once
+#include <SFML/System.hpp>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Startup work as a small task graph. Worker tasks run on their own threads
+// as soon as their dependencies finish; main tasks run inside pump() on the
+// thread that ticks the SystemScheduler, so they may touch GL and the
+// single-threaded managers. A task may also wait on a readiness check, such
+// as AsyncAssetLoader going idle. Dependencies are named and must be added
+// before the tasks that use them, which also rules out cycles.
+class StartupPipeline {
+public:
+    enum class Affinity { Worker, Main };
+
+    using TaskFunction = std::function<void()>;
+    using ReadyCheck = std::function<bool()>;
+
+    StartupPipeline() = default;
+    ~StartupPipeline();                                  // Waits for running worker tasks
+    StartupPipeline(const StartupPipeline&) = delete;
+    StartupPipeline& operator=(const StartupPipeline&) = delete;
+
+    void addTask(const std::string& name, Affinity affinity, const std::vector<std::string>& dependencies,
+        TaskFunction run, ReadyCheck ready = nullptr);
+
+    void pump();                                         // Launch and run whatever is ready; once per frame
+    bool isComplete() const { return m_completed == m_tasks.size(); }
+
+    float getElapsedMs() const { return m_clock.getElapsedTime().asSeconds() * 1000.0f; } // Since construction
+    void logMilestone(const std::string& name);          // Elapsed time, once per name; any thread
+
+private:
+    enum class TaskState { Waiting, Running, Done };
+
+    struct Task {
+        std::string name;
+        Affinity affinity = Affinity::Main;
+        std::vector<size_t> dependencies;
+        TaskFunction run;
+        ReadyCheck ready;
+        TaskState state = TaskState::Waiting;
+        std::future<float> result;                       // Worker tasks: milliseconds spent
+    };
+
+    bool canStart(const Task& task) const;
+    void finish(Task& task, float ms);
+
+    sf::Clock m_clock;
+    std::vector<Task> m_tasks;
+    size_t m_completed = 0;
+    std::mutex m_milestoneMutex;                         // Present and simulation threads both log
+    std::vector<std::string> m_loggedMilestones;
+};
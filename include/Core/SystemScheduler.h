@@ -0,0 +1,72 @@
+// ================================
+// include/Core/SystemScheduler.h - Ordered once-per-frame system ticks with timing
+// ================================
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Phases run in declaration order; systems within a phase run in registration order
+enum class SystemPhase : std::uint8_t {
+    Input = 0,                                           // Window/UI events into states
+    Simulation,                                          // State and gameplay logic
+    Physics,                                             // Box2D step
+    PostPhysics,                                         // Event dispatch, reactions to contacts
+    Animation,                                           // Advance animation clocks
+    RenderPrep,                                          // Work that must see final positions
+    Count
+};
+
+class SystemScheduler {
+public:
+    using SystemId = std::uint32_t;
+    using TickFunction = std::function<void(float dt)>;
+
+    struct SystemTiming {
+        std::string name;
+        SystemPhase phase = SystemPhase::Simulation;
+        float lastMs = 0.0f;                             // Duration of the latest tick
+        float averageMs = 0.0f;                          // Exponential moving average
+        float maxMs = 0.0f;                              // Worst tick since last reset
+        std::uint64_t ticks = 0;
+    };
+
+    static constexpr SystemId INVALID_SYSTEM = 0;
+
+    static SystemScheduler& getInstance();               // Singleton access
+
+    SystemId registerSystem(SystemPhase phase, const std::string& name, TickFunction tick);
+    void unregisterSystem(SystemId id);                  // Safe to call from inside a tick
+
+    void tick(float dt);                                 // Run every phase once
+
+    std::vector<SystemTiming> getTimings() const;        // In execution order
+    const SystemTiming* getTiming(const std::string& name) const;
+    float getLastFrameMs() const { return m_lastFrameMs; }
+    void resetTimings();
+
+    static const char* getPhaseName(SystemPhase phase);
+
+private:
+    SystemScheduler() = default;
+    ~SystemScheduler() = default;
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    struct SystemEntry {
+        SystemId id = INVALID_SYSTEM;
+        TickFunction tick;
+        SystemTiming timing;
+        bool removed = false;
+    };
+
+    void applyPendingChanges();                          // Merge adds/removals outside a tick
+
+    std::vector<SystemEntry> m_phases[static_cast<size_t>(SystemPhase::Count)];
+    std::vector<std::pair<SystemPhase, SystemEntry>> m_pendingAdds; // Registered during a tick
+    SystemId m_nextId = 1;
+    bool m_ticking = false;
+    bool m_hasRemovals = false;
+    float m_lastFrameMs = 0.0f;
+};
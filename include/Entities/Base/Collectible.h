@@ -12,7 +12,7 @@ public:
     GameTypes::ObjectCategory getObjectCategory() const override { return GameTypes::ObjectCategory::Collectible; }
 
     void update(float dt) override;                          // Update collectible state
-    void draw(sf::RenderWindow& window) const override;      // Draw collectible
+    void draw(sf::RenderTarget& window) const override;      // Draw collectible
 
     GameTypes::CollectibleType getType() const;              // Get collectible type
     int getValue() const;                                    // Get point/heal value
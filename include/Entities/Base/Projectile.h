@@ -16,7 +16,7 @@ public:
     GameTypes::ObjectCategory getObjectCategory() const override { return GameTypes::ObjectCategory::Projectile; }
 
     void update(float dt) override;                           // Update projectile state
-    void draw(sf::RenderWindow& window) const override;       // Render projectile
+    void draw(sf::RenderTarget& window) const override;       // Render projectile
     void createPhysicsBody(b2World* world) override;          // Create physics body
 
     GameTypes::ProjectileType getType() const;                // Get projectile type
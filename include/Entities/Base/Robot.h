@@ -14,7 +14,7 @@ public:
     GameTypes::ObjectCategory getObjectCategory() const override { return GameTypes::ObjectCategory::Robot; }
 
     void update(float dt) override;                            // Update robot logic
-    void draw(sf::RenderWindow& window) const override;        // Draw robot
+    void draw(sf::RenderTarget& window) const override;        // Draw robot
 
     virtual void takeDamage(int damage);                       // Apply damage
     virtual void heal(int amount);                             // Heal amount
@@ -23,6 +23,7 @@ public:
     bool isDead() const;                                       // Is dead
 
     GameTypes::RobotType getType() const;                      // Robot type
+    virtual void reloadConfig();                               // Re-read stats after a config hot reload
     int getDamage() const;                                     // Damage value
     int getRewardValue() const;                                // Coins reward on kill
 
@@ -101,5 +102,5 @@ protected:
     virtual float calculateDistanceToMember(const SquadMember* member) const; // Calc distance
 
     void loadAttackRangeFromConfig();                         // Load attack range
-    void drawHealthBar(sf::RenderWindow& window) const;       // Draw health bar
+    void queueHealthBar() const;                              // Queue health bar into the batch
 };
\ No newline at end of file
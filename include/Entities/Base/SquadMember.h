@@ -19,7 +19,7 @@ public:
     }
 
     void update(float dt) override;                    // Update squad member
-    void draw(sf::RenderWindow& window) const override;// Draw squad member
+    void draw(sf::RenderTarget& window) const override;// Draw squad member
 
     virtual void attack(const std::vector<std::unique_ptr<Robot>>& robots) = 0; // Attack logic (pure virtual)
     virtual Robot* findTarget(const std::vector<std::unique_ptr<Robot>>& robots) const; // Find target robot
@@ -51,6 +51,7 @@ public:
     bool isDestroyed() const;                          // Check if destroyed
 
     bool canBePlacedAt(int lane, int gridX) const override; // Validate placement
+    void reloadConfig();                               // Re-read units.cfg after a hot reload
 
     virtual void onRobotCollision(Robot* attacker);    // Handle collision with robot
     virtual void onRobotBulletHit(int damage);         // Handle hit by bullet
@@ -79,7 +80,7 @@ protected:
     std::vector<Robot*> m_attackingRobots;             // List of attacking robots
     bool m_underAttack = false;                        // Under attack flag
 
-    void initializeConfigFromName(const std::string& configName, float defaultAttackSpeed = 1.5f); // Load config
+    void initializeConfigFromArchetype();              // Load stats for m_type from units.cfg
 
     virtual void updateTargeting(const std::vector<std::unique_ptr<Robot>>& robots); // Update target selection
     virtual void updateAttack(float dt);                 // Update attack logic
@@ -89,5 +90,5 @@ protected:
     bool isValidTarget(const Robot* robot) const;        // Validate if robot is a valid target
 
 private:
-    void drawHealthBar(sf::RenderWindow& window) const;  // Draw health bar
+    void queueHealthBar() const;                         // Queue health bar into the batch
 };
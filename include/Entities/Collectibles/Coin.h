@@ -9,7 +9,7 @@ public:
     virtual ~Coin() = default;                        // Default destructor
 
     void update(float dt) override;                   // Update coin logic
-    void draw(sf::RenderWindow& window) const override; // Draw coin
+    void draw(sf::RenderTarget& window) const override; // Draw coin
     void applyEffect() override;                      // Apply coin effect (grant coins)
 
     void createPhysicsBody(b2World* world) override {} // No physics body for coin
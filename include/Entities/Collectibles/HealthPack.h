@@ -13,7 +13,7 @@ public:
     virtual ~HealthPack() = default;                   // Default destructor
 
     void update(float dt) override;                    // Update health pack state
-    void draw(sf::RenderWindow& window) const override;// Draw health pack
+    void draw(sf::RenderTarget& window) const override;// Draw health pack
     void applyEffect() override;                       // Apply effect when collected
 
     void healSquadMember(SquadMember* member);         // Heal specific squad member
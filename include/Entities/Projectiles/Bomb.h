@@ -8,7 +8,7 @@ public:
     Bomb(const sf::Vector2f& pos);                     // Constructor with position
 
     void update(float dt);                             // Update bomb state
-    void render(sf::RenderWindow& window) const;       // Render bomb
+    void render(sf::RenderTarget& window) const;       // Render bomb
     bool isDone() const;                               // Check if bomb is finished
 
     void explode();                                    // Trigger explosion
@@ -17,7 +17,7 @@ public:
     }
 
     void update(float dt) override;                                                  // Update bullet state
-    void draw(sf::RenderWindow& window) const override;                              // Draw bullet
+    void draw(sf::RenderTarget& window) const override;                              // Draw bullet
     void createPhysicsBody(b2World* world) override;                                 // Create physics body
 
     void updateTrajectory(float dt) override;                                        // Update trajectory
@@ -13,7 +13,7 @@ public:
     virtual ~SniperBullet() = default;                                                  // Default destructor
 
     void update(float dt) override;                                                     // Update sniper bullet
-    void draw(sf::RenderWindow& window) const override;                                 // Draw sniper bullet
+    void draw(sf::RenderTarget& window) const override;                                 // Draw sniper bullet
     void createPhysicsBody(b2World* world) override;                                    // Create physics body
 
     void updateTrajectory(float dt) override;                                           // Update bullet trajectory
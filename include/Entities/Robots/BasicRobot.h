@@ -21,5 +21,8 @@ protected:
 
 private:
     bool m_deathAnimationStarted = false;                // Death animation state
+    AnimationId m_walkClip = INVALID_ANIMATION_ID;       // Interned clip ids
+    AnimationId m_hitClip = INVALID_ANIMATION_ID;
+    AnimationId m_deadClip = INVALID_ANIMATION_ID;
     void setupFromConfig();                              // Load properties from config
 };
\ No newline at end of file
@@ -9,6 +9,7 @@ public:
     virtual ~FireRobot() = default;                     // Default destructor
 
     void update(float dt) override;                     // Update robot logic
+    void reloadConfig() override;                       // Also refresh bullet cooldown and damage
 
     void useSpecialAbility() override {}                // No special ability
     bool hasSpecialAbility() const override { return false; } // No special ability
@@ -38,6 +39,9 @@ private:
 
     bool m_deathAnimationStarted = false;               // Is death animation started
     std::string m_currentAnimationState = "walking";    // Current animation state
+    AnimationId m_walkClip = INVALID_ANIMATION_ID;      // Interned clip ids
+    AnimationId m_staticClip = INVALID_ANIMATION_ID;
+    AnimationId m_deathClip = INVALID_ANIMATION_ID;
 
     void setupFromConfig();                             // Load settings from config
     ConfigLoader::RobotConfig getConfig() const;        // Get config struct
@@ -28,6 +28,9 @@ private:
     bool m_deathAnimationStarted = false;                 // Is death animation started
     std::string m_currentAnimationState = "walking";      // Current animation state
     bool m_isAttacking = false;                           // Is currently attacking
+    AnimationId m_walkClip = INVALID_ANIMATION_ID;        // Interned clip ids
+    AnimationId m_hitClip = INVALID_ANIMATION_ID;
+    AnimationId m_deadClip = INVALID_ANIMATION_ID;
 
     void setupFromConfig();                               // Setup from config
     ConfigLoader::RobotConfig getConfig() const;          // Get robot config
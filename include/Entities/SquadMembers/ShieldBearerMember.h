@@ -1,7 +1,7 @@
 ﻿#pragma once
 
 #include "Entities/Base/SquadMember.h"
-#include "Graphics/AnimationComponent.h"
+#include "Systems/AnimationHandle.h"
 #include "Core/Timer.h"
 #include "Utils/ConfigLoader.h"
 #include <memory>
@@ -15,7 +15,6 @@ public:
     virtual ~ShieldBearerMember() = default;                   // Default destructor
 
     void update(float dt) override;                            // Update logic
-    void draw(sf::RenderWindow& window) const override;        // Draw unit
     void attack(const std::vector<std::unique_ptr<Robot>>& robots) override; // Attack behavior
     Robot* findTarget(const std::vector<std::unique_ptr<Robot>>& robots) const override; // Find target
 
@@ -33,7 +32,9 @@ public:
     void setNearbyRobots(const std::vector<std::unique_ptr<Robot>>* robots); // Set nearby robots
 
 private:
-    mutable AnimationComponent m_animationComponent;           // Animation component
+    AnimationId m_idleClip = INVALID_ANIMATION_ID;             // Interned clip ids
+    AnimationId m_blockClip = INVALID_ANIMATION_ID;
+    AnimationId m_deadClip = INVALID_ANIMATION_ID;
 
     enum class AnimationState {                                // Animation states
         Idle,
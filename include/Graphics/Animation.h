@@ -3,12 +3,22 @@
 // ================================
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <vector>
 
+// Clip metadata resolved once when an Animation is created
+namespace AnimationFlags {
+    constexpr std::uint8_t None = 0;
+    constexpr std::uint8_t Loop = 1 << 0;          // Restart after the last frame (otherwise hold it)
+    constexpr std::uint8_t FlipX = 1 << 1;         // Sheet faces left; mirror to face the play direction
+}
+
 class Animation {
 public:
     // Constructor to initialize animation with texture and frame details
     Animation(const sf::Texture& texture, int frameWidth, int frameHeight, int frameCount, float duration);
+    // Constructor using precomputed frame rectangles (e.g. from a packed atlas)
+    Animation(const sf::Texture& texture, const std::vector<sf::IntRect>& frames, float duration);
 
     void update(float dt);                         // Update current frame based on time
     void applyToSprite(sf::Sprite& sprite) const;  // Apply current frame to sprite
@@ -18,9 +28,19 @@ public:
     int getFrameCount() const;                     // Get total number of frames
     float getDuration() const;                     // Get total animation duration
 
+    void setFlags(std::uint8_t flags) { m_flags = flags; }         // AnimationFlags bitmask
+    std::uint8_t getFlags() const { return m_flags; }
+    bool isLooping() const { return (m_flags & AnimationFlags::Loop) != 0; }
+    bool isFlippedX() const { return (m_flags & AnimationFlags::FlipX) != 0; }
+
+    void setFrameDurations(const std::vector<float>& durations);   // Per-frame timing; sets total duration
+    int getFrameAt(float time) const;              // Frame shown at time in [0, duration)
+
 private:
     const sf::Texture& m_texture;                  // Texture containing animation frames
     std::vector<sf::IntRect> m_frames;             // List of frame rectangles
     int m_frameCount;                              // Total frame count
     float m_duration;                              // Duration for the full animation cycle
+    std::uint8_t m_flags = AnimationFlags::Loop;   // AnimationFlags bitmask
+    std::vector<float> m_frameEndTimes;            // Cumulative end time per frame; empty when uniform
 };
@@ -0,0 +1,72 @@
+// ================================
+// include/Graphics/AnimationClipTable.h - animations.cfg compiled to a mappable binary table
+// ================================
+#pragma once
+#include "Utils/MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The first load parses the .cfg and writes a binary cache next to it.
+// Later loads memory-map the cache and read records in place, as long as
+// the cache stamp still matches the .cfg file's size and write time.
+class AnimationClipTable {
+public:
+    struct ClipRecord {                                  // Fixed-size, 4-byte aligned
+        std::uint32_t nameOffset;                        // Into the string blob
+        std::uint32_t sheetOffset;
+        std::int32_t frameCount;
+        std::int32_t frameWidth;                         // 0 = sheet width / frameCount
+        std::int32_t frameHeight;                        // 0 = sheet height
+        float duration;
+        std::uint32_t flags;                             // AnimationFlags bitmask
+        std::uint32_t frameDurationIndex;                // Into the float table
+        std::uint32_t frameDurationCount;                // 0 = uniform timing
+    };
+
+    bool load(const std::string& sourceFile, const std::string& cacheFile); // False if no usable data
+    void close();                                        // Drop mapping / compiled buffer
+
+    size_t getClipCount() const;
+    const ClipRecord& getClip(size_t index) const;
+    const char* getString(std::uint32_t offset) const;
+    std::vector<float> getFrameDurations(const ClipRecord& clip) const;
+
+    bool isMapped() const { return m_mapping.isOpen(); } // True when served from the cache file
+
+private:
+    struct Header {
+        char magic[4];
+        std::uint32_t version;
+        std::uint64_t sourceStamp;                       // Size and mtime of the .cfg it came from
+        std::uint32_t clipCount;
+        std::uint32_t floatCount;
+        std::uint32_t stringBytes;
+        std::uint32_t reserved;
+    };
+
+    struct ClipDefinition {
+        std::string name;
+        std::string sheet;
+        int frameCount = 1;
+        int frameWidth = 0;
+        int frameHeight = 0;
+        float duration = 1.0f;
+        bool loop = true;
+        bool flipX = false;
+        std::vector<float> frameDurations;
+    };
+
+    static std::uint64_t sourceStamp(const std::string& sourceFile);
+    static bool parseSource(const std::string& sourceFile, std::vector<ClipDefinition>& clips);
+    static std::vector<std::uint8_t> compile(const std::vector<ClipDefinition>& clips, std::uint64_t stamp);
+
+    bool attach(const std::uint8_t* data, size_t size, std::uint64_t expectedStamp);
+
+    MappedFile m_mapping;
+    std::vector<std::uint8_t> m_compiled;                // Used when the cache could not be written
+    const Header* m_header = nullptr;
+    const ClipRecord* m_clips = nullptr;
+    const float* m_floats = nullptr;
+    const char* m_strings = nullptr;
+};
@@ -3,9 +3,12 @@
 // ================================
 #pragma once
 #include "Graphics/Animation.h"
+#include "Graphics/RenderQueue.h"
+#include "Systems/AnimationHandle.h"
 #include <SFML/Graphics.hpp>
 #include <functional>
 #include <map>
+#include <vector>
 
 class AnimationComponent {
 public:
@@ -14,10 +17,12 @@ public:
     using AnimationCallback = std::function<void()>;
 
     explicit AnimationComponent(void* owner);                       // Constructor with owner reference
-    void play(const Animation& animation, const std::string& animationName = ""); // Play animation
+    void play(const Animation& animation, AnimationId animationId = INVALID_ANIMATION_ID); // Play animation
     void update(float dt);                                          // Update animation timing
-    void draw(sf::RenderWindow& window) const;                      // Draw current frame
+    void update(float dt, std::vector<AnimationCallback>& fired);   // Same, but queues callbacks instead of running them
+    void queueDraw() const;                                         // Submit current frame to RenderQueue
     void setPosition(const sf::Vector2f& pos);                      // Set sprite position
+    void setRenderLayer(RenderLayer layer) { m_renderLayer = layer; } // Layer used by queueDraw
 
     // Frame detection methods
     int getCurrentFrame() const { return m_currentFrame; }          // Get current frame index
@@ -27,8 +32,8 @@ public:
 
     // Animation state queries
     bool isAnimationComplete() const;                              // Check if animation complete
-    const std::string& getCurrentAnimationName() const { return m_currentAnimationName; } // Current anim name
-    bool isPlayingAnimation(const std::string& name) const { return m_currentAnimationName == name; } // Is playing specific anim
+    bool isPlayingAnimation(AnimationId id) const { return id != INVALID_ANIMATION_ID && m_currentAnimationId == id; } // Is playing specific anim
+    AnimationId getCurrentAnimationId() const { return m_currentAnimationId; } // Current anim id
 
     // Callback system
     void setFrameCallback(int frameIndex, FrameCallback callback);  // Set callback for specific frame
@@ -50,21 +55,23 @@ public:
 private:
     void* m_owner;                              // Owner of the component
     const Animation* m_currentAnimation = nullptr; // Current animation
-    std::string m_currentAnimationName;         // Name of the current animation
+    AnimationId m_currentAnimationId = INVALID_ANIMATION_ID; // Interned id of the current animation
     float m_time = 0.f;                         // Time accumulator
     int m_currentFrame = 0;                     // Current frame index
     int m_previousFrame = -1;                   // Previously displayed frame
     sf::Sprite m_sprite;                        // Sprite to render
+    RenderLayer m_renderLayer = RenderLayer::Units; // Sort layer for the render queue
 
     bool m_paused = false;                      // Is animation paused
+    bool m_completed = false;                   // Finished at least one cycle
+    bool m_holding = false;                     // One-shot clip parked on its last frame
     float m_animationSpeed = 1.0f;              // Speed multiplier
 
     std::map<int, FrameCallback> m_frameCallbacks;       // Frame-specific callbacks
     AnimationCallback m_animationCompleteCallback;       // Callback when anim completes
 
-    // Helper methods
-    void checkFrameCallbacks();                 // Check and execute frame callbacks
-    void checkAnimationComplete();              // Check if animation is done
-
-    bool needsHorizontalFlip() const;           // Should sprite be flipped horizontally
+    // Helper methods - callbacks go to fired when given, otherwise run immediately
+    void advance(float dt, std::vector<AnimationCallback>* fired);
+    void checkFrameCallbacks(std::vector<AnimationCallback>* fired);  // Check and execute frame callbacks
+    void checkAnimationComplete(std::vector<AnimationCallback>* fired); // Check if animation is done
 };
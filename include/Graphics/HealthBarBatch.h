@@ -0,0 +1,29 @@
+// ================================
+// include/Graphics/HealthBarBatch.h
+// ================================
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// Collects every entity health bar for the frame into one vertex array
+class HealthBarBatch {
+public:
+    static HealthBarBatch& getInstance();                              // Singleton access
+
+    void addBar(const sf::Vector2f& entityPosition, float healthPercent); // Queue bar above an entity
+    void flush(sf::RenderTarget& target);                              // Draw all bars in one call, then reset
+    void clear();                                                      // Drop queued bars without drawing
+
+    size_t getBarCount() const { return m_barCount; }                  // Bars queued this frame
+
+private:
+    HealthBarBatch();
+    ~HealthBarBatch() = default;
+    HealthBarBatch(const HealthBarBatch&) = delete;
+    HealthBarBatch& operator=(const HealthBarBatch&) = delete;
+
+    void appendQuad(float x, float y, float width, float height, const sf::Color& color);
+    static sf::Color colorForPercent(float healthPercent);
+
+    sf::VertexArray m_vertices;                                        // Quads; capacity reused across frames
+    size_t m_barCount = 0;
+};
@@ -0,0 +1,60 @@
+// ================================
+// include/Graphics/RenderQueue.h - Sorted, batched sprite submission
+// ================================
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Draw layers, back to front. Within a layer quads are ordered by y-depth.
+enum class RenderLayer : std::uint8_t {
+    Ground = 0,                                                        // Items lying on the field
+    Units,                                                             // Squad members and robots
+    Collectibles,                                                      // Coins and health packs
+    Projectiles,                                                       // Bullets
+    Effects                                                            // Explosions
+};
+
+// Entities submit quads during render; flush() radix-sorts them by
+// (layer, y-depth, texture) and draws each run of equal texture in one call.
+class RenderQueue {
+public:
+    static RenderQueue& getInstance();                                 // Singleton access
+
+    void submit(RenderLayer layer, const sf::Sprite& sprite);          // Depth = sprite position y
+    void submit(RenderLayer layer, float depth, const sf::Sprite& sprite);
+    void submitRect(RenderLayer layer, const sf::FloatRect& rect, const sf::Color& color); // Untextured quad
+    void flush(sf::RenderTarget& target);                              // Sort, draw, then reset
+    void clear();                                                      // Drop queued quads without drawing
+
+    size_t getQuadCount() const { return m_quads.size(); }             // Quads queued this frame
+    size_t getLastDrawCalls() const { return m_lastDrawCalls; }        // Draw calls issued by the last flush
+
+    static std::uint64_t makeKey(RenderLayer layer, float depth, const sf::Texture* texture);
+
+private:
+    RenderQueue();
+    ~RenderQueue() = default;
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    struct QueuedQuad {
+        std::array<sf::Vertex, 4> vertices;
+        const sf::Texture* texture = nullptr;
+    };
+
+    struct SortEntry {
+        std::uint64_t key;
+        std::uint32_t index;                                           // Into m_quads
+    };
+
+    void push(std::uint64_t key, const QueuedQuad& quad);
+    void radixSort();                                                  // Stable LSD sort of m_order by key
+
+    std::vector<QueuedQuad> m_quads;                                   // Capacity reused across frames
+    std::vector<SortEntry> m_order;
+    std::vector<SortEntry> m_scratch;
+    sf::VertexArray m_batch;                                           // Current same-texture run
+    size_t m_lastDrawCalls = 0;
+};
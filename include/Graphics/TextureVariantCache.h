@@ -0,0 +1,35 @@
+// ================================
+// include/Graphics/TextureVariantCache.h - Resolution-sized texture variants cached on disk
+// ================================
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+
+// Large backgrounds are stored once at authoring size. For a smaller screen
+// a downscaled copy is generated the first time it is needed and written to
+// texture_cache/, named after its size and the source's byte size and last
+// write time (content hash when packed), so an edited source produces a fresh
+// variant. Stateless, so workers may call it.
+class TextureVariantCache {
+public:
+    struct Variant {
+        std::string sourceFile;
+        std::string cacheFile;                           // Empty when the source is used as is
+        sf::Vector2u sourceSize;                         // Authoring size, (0,0) if unknown
+        sf::Vector2u size;                               // Size of the texture actually loaded
+        bool isScaled() const { return !cacheFile.empty(); }
+    };
+
+    // Smallest size that still covers the resolution; reads only the image header
+    static Variant select(const std::string& sourceFile, const sf::Vector2u& resolution);
+
+    // Cached file if present, else decode, downscale and save; safe on any thread
+    static bool loadImage(const Variant& variant, sf::Image& image);
+
+    static std::string textureName(const Variant& variant); // ResourceManager cache key
+
+private:
+    static bool loadSource(const std::string& sourceFile, sf::Image& image);
+    static sf::Image downscale(const sf::Image& source, const sf::Vector2u& size);
+};
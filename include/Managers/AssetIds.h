@@ -0,0 +1,45 @@
+// ================================
+// include/Managers/AssetIds.h - Integer handles for sounds, fonts and textures
+// ================================
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Assets are resolved from their names once and then looked up by index.
+// Built-in assets have compile-time ids in the order below; other names get
+// ids past BuiltinCount the first time getSoundId/getFontId/getTextureId sees
+// them. An id stays valid for the whole run, even while the asset is unloaded.
+
+enum class SoundId : std::uint16_t {
+    // UI and game events
+    ButtonHover, Click, CoinAdded, HealthKitAdded, Explosion, Placed, Killed, LevelUp, GameOver, Error,
+    // Combat
+    HeavyGunnerShot, RobotBullet, SniperShot, ShieldBarrierFight,
+    // Hits
+    StealthRobotHit, RockRobotHit,
+    // Deaths
+    SquadDied, RockRobotDie, ShieldDied, StealthRobotDie,
+    // UI
+    More,
+    BuiltinCount,
+    Invalid = 0xFFFF
+};
+
+enum class FontId : std::uint16_t {
+    Game,                          // "bruce", the title and HUD font
+    Ui,                            // DejaVuSans.ttf, small overlay text
+    BuiltinCount,
+    Invalid = 0xFFFF
+};
+
+enum class TextureId : std::uint16_t {
+    // Projectiles
+    Bullet, SniperBullet, RobotBullet, Bomb,
+    // Grid and widgets
+    PlacingSlot, Button, SliderKnob, BombIcon,
+    BuiltinCount,
+    Invalid = 0xFFFF
+};
+
+template<typename Id>
+constexpr size_t assetIndex(Id id) { return static_cast<size_t>(id); }
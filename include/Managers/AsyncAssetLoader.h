@@ -0,0 +1,94 @@
+// ================================
+// include/Managers/AsyncAssetLoader.h - Parallel image decode, budgeted texture upload
+// ================================
+#pragma once
+#include "Graphics/TextureVariantCache.h"
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Worker threads only decode images through TextureVariantCache (loose files,
+// AssetArchive entries or cached downscaled variants) and never touch
+// ResourceManager. The thread that ticks the SystemScheduler calls pump(),
+// which uploads decoded images into textures within a time budget and hands
+// them to ResourceManager - so all resource maps stay single-threaded.
+//
+// Futures resolve inside pump(); never block on one from the pumping thread,
+// use flush() instead.
+class AsyncAssetLoader {
+public:
+    struct Progress {
+        size_t requested = 0;                            // Since the last idle point
+        size_t completed = 0;                            // Uploaded or failed
+        size_t failed = 0;
+        float fraction() const { return requested > 0 ? static_cast<float>(completed) / requested : 1.0f; }
+    };
+
+    static AsyncAssetLoader& getInstance();              // Singleton access
+
+    void start(unsigned workerCount = 0);                // 0 = one per core, minus the main thread
+    void shutdown();                                     // Joins workers, fails pending requests
+
+    std::shared_future<bool> loadTextureAsync(const std::string& name, const std::string& filename);
+    std::shared_future<bool> loadTextureAsync(const TextureVariantCache::Variant& variant); // Named by textureName()
+
+    void pump(float budgetMs);                           // Upload decoded images; main thread
+    void flush();                                        // Pump until every request is done
+
+    Progress getProgress() const { return m_progress; }
+    bool isIdle() const { return m_pending.empty(); }
+
+    void setUploadBudget(float budgetMs) { m_uploadBudgetMs = budgetMs; }
+    float getUploadBudget() const { return m_uploadBudgetMs; }
+
+private:
+    AsyncAssetLoader() = default;
+    ~AsyncAssetLoader();
+    AsyncAssetLoader(const AsyncAssetLoader&) = delete;
+    AsyncAssetLoader& operator=(const AsyncAssetLoader&) = delete;
+
+    struct DecodeJob {
+        std::string name;
+        TextureVariantCache::Variant variant;             // Unscaled unless a cache file is set
+    };
+
+    struct DecodedImage {
+        std::string name;
+        sf::Image image;
+        bool ok = false;
+    };
+
+    struct PendingRequest {
+        std::promise<bool> promise;
+        std::shared_future<bool> future;
+    };
+
+    std::shared_future<bool> enqueue(const std::string& name, const TextureVariantCache::Variant& variant);
+    void workerLoop();
+    void complete(const std::string& name, bool ok);
+
+    // Shared with workers
+    std::vector<std::thread> m_workers;
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobReady;
+    std::deque<DecodeJob> m_jobs;
+    bool m_stopping = false;
+
+    std::mutex m_decodedMutex;
+    std::condition_variable m_decodedReady;              // Wakes flush()
+    std::vector<DecodedImage> m_decoded;
+
+    // Pumping thread only
+    std::unordered_map<std::string, PendingRequest> m_pending;
+    std::vector<DecodedImage> m_uploadQueue;             // Decoded, waiting for budget
+    Progress m_progress;
+    float m_uploadBudgetMs = 4.0f;
+};
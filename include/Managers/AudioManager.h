@@ -1,6 +1,10 @@
 #pragma once
 
+#include "Managers/AssetIds.h"
 #include <SFML/Audio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
 #include <string>
@@ -15,6 +19,16 @@ public:
         UI,
     };
 
+    static constexpr size_t VOICE_COUNT = 32;          // Sounds that can play at once
+
+    // Per-sound limits from sounds.cfg; triggers over a limit merge into the newest voice
+    struct SoundRule {
+        int maxInstances = 4;          // Voices this sound may hold at once
+        float retriggerInterval = 0.03f; // Seconds between voice starts
+        float mergeGain = 0.25f;       // Share of a merged trigger's volume added
+        float maxVolume = 1.0f;        // Ceiling for merged volume bumps
+    };
+
     // Struct to hold audio volume and toggle settings
     struct AudioSettings {
         float masterVolume = 100.f;
@@ -26,18 +40,40 @@ public:
         bool sfxEnabled = true;
     };
 
+    // Samples read from a sound file; decoding makes no OpenAL calls
+    struct DecodedSound {
+        std::string name;
+        std::vector<sf::Int16> samples;
+        unsigned channelCount = 0;
+        unsigned sampleRate = 0;
+    };
+
     static AudioManager& getInstance(); // Singleton access
 
-    void initialize(); // Initialize audio system
+    void initialize(); // Initialize audio system, decoding on this thread
+    void initialize(std::vector<DecodedSound> sounds); // Initialize with sounds decoded elsewhere
+    static std::vector<DecodedSound> decodeBuiltinSounds(); // Safe on any thread
+    static bool decodeSound(const std::string& filename, DecodedSound& sound); // Archive, then loose file
     void shutdown();   // Shutdown and cleanup
 
     bool loadSound(const std::string& name, const std::string& filename); // Load sound buffer
+    SoundId getSoundId(const std::string& name);                          // Resolve once, play by id
     bool loadMusic(const std::string& name, const std::string& filename); // Load music track
 
-    void playSound(const std::string& name, float volume = 1.0f); // Play sound by name
-    void playSound(const std::string& name, AudioCategory category, float volume = 1.0f); // Play sound with category
+    void playSound(SoundId id, float volume = 1.0f); // Play sound by id
+    void playSound(SoundId id, AudioCategory category, float volume = 1.0f); // Play sound with category
+    void playSound(const std::string& name, float volume = 1.0f); // Resolves the name on every call
+    void playSound(const std::string& name, AudioCategory category, float volume = 1.0f);
     void stopAllSounds(); // Stop all currently playing sounds
 
+    void setCategoryPriority(AudioCategory category, int priority); // Higher steals lower when voices run out
+    int getCategoryPriority(AudioCategory category) const;
+    size_t getActiveVoiceCount() const { return VOICE_COUNT - m_freeVoiceCount; } // Claimed since last update
+
+    bool loadSoundRules(const std::string& filename); // Read the sound table
+    void setSoundRule(const std::string& name, const SoundRule& rule);
+    SoundRule getSoundRule(const std::string& name) const;
+
     void playMusic(const std::string& name, bool loop = true); // Play music track
     void stopMusic();       // Stop current music
     void pauseMusic();      // Pause music playback
@@ -52,26 +88,58 @@ public:
     void setMuted(bool muted); // Mute or unmute all audio
     bool isMuted() const;      // Check if audio is muted
 
-    void update(float dt); // Update active sounds per frame
+    void update(float dt); // Reclaim finished voices, once per frame
 
     void applySettings(const AudioSettings& settings); // Apply complete settings
     AudioSettings getSettings() const; // Retrieve current settings
 
+    size_t getSoundMemoryUsage() const; // Sample bytes of loaded sound buffers; music streams
+
 private:
-    AudioManager() = default;
+    AudioManager();
     ~AudioManager() = default;
     AudioManager(const AudioManager&) = delete;
     AudioManager& operator=(const AudioManager&) = delete;
 
-    std::unordered_map<std::string, std::unique_ptr<sf::SoundBuffer>> m_soundBuffers; // Loaded sound buffers
+    struct SoundEntry {
+        std::string name;
+        std::unique_ptr<sf::SoundBuffer> buffer; // Null until loaded
+        SoundRule rule;
+        float lastStartTime = -1.0f;   // Seconds on m_clock; merges do not reset it
+        int playingCount = 0;          // Voices started and not yet reclaimed or stolen
+        int newestVoice = -1;          // Index into m_voices, -1 if none
+    };
+
+    std::vector<SoundEntry> m_sounds;                                                 // Indexed by SoundId
+    std::unordered_map<std::string, SoundId> m_soundIds;                              // Name -> index into m_sounds
     std::unordered_map<std::string, std::unique_ptr<sf::Music>> m_musicTracks;        // Loaded music tracks
-    std::vector<std::unique_ptr<sf::Sound>> m_activeSounds;                           // Active playing sounds
+    std::unordered_map<std::string, SoundRule> m_soundRules;                          // Sound table overrides
+    SoundRule m_defaultRule;                                                          // Sound table [Default]
+    sf::Clock m_clock;                                                                // Retrigger timing
+
+    // Preallocated voices; declared after the buffers so they are destroyed first
+    struct Voice {
+        sf::Sound sound;
+        SoundId soundId = SoundId::Invalid; // Sound playing here; Invalid once released
+        AudioCategory category = AudioCategory::SFX;
+        float volume = 1.0f;           // Requested volume, before category and master
+        std::uint64_t startOrder = 0;  // For oldest-first stealing
+        bool claimed = false;          // Off the free list
+    };
+    std::array<Voice, VOICE_COUNT> m_voices;
+    std::array<std::uint8_t, VOICE_COUNT> m_freeVoices{};                             // Stack of voice indices
+    size_t m_freeVoiceCount = 0;
+    std::uint64_t m_voiceStartCounter = 0;
+    std::array<int, 3> m_categoryPriorities = { 2, 1, 3 };                            // Music, SFX, UI
 
     sf::Music* m_currentMusic = nullptr; // Pointer to current music
     std::string m_currentMusicName;      // Name of the current music
     AudioSettings m_settings;            // Current audio settings
 
-    void cleanupStoppedSounds(); // Remove stopped sounds from memory
+    Voice* acquireVoice(AudioCategory category); // Free voice, stolen voice, or nullptr
+    void reclaimFinishedVoices();                // Return stopped voices to the free list
+    void releaseVoice(size_t index);             // Drop the voice from its sound's playing count
+    bool mergeTrigger(SoundId id, float volume); // Apply the sound's limits; true when merged
     float computeFinalVolume(AudioCategory category, float volume) const; // Calculate final volume level
     std::string getFullPath(const std::string& filename) const; // Resolve full file path
 };
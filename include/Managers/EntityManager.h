@@ -38,7 +38,7 @@ public:
         }
     }
 
-    virtual void draw(sf::RenderWindow& window) const {
+    virtual void draw(sf::RenderTarget& window) const {
         for (const auto& entity : m_entities) {
             if (entity && entity->isActive()) entity->draw(window);
         }
@@ -0,0 +1,50 @@
+// ================================
+// include/Managers/HotReloadManager.h - Live reload of edited configs and textures
+// ================================
+#pragma once
+#include "Utils/ConfigLoader.h"
+#include "Utils/FileWatcher.h"
+#include <SFML/Graphics.hpp>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// The FileWatcher thread parses changed .cfg files and decodes changed images.
+// applyPending(), run once per frame by the SystemScheduler, merges them into
+// ConfigLoader and ResourceManager and publishes ConfigReloadedEvent so live
+// entities pick up the new values - nothing is touched mid-frame.
+class HotReloadManager {
+public:
+    static HotReloadManager& getInstance();              // Singleton access
+
+    bool start(const std::string& directory);            // Watch the directory assets load from
+    void stop();
+    bool isRunning() const { return m_watcher.isRunning(); }
+
+    void applyPending();                                 // Frame boundary, scheduler thread
+
+private:
+    HotReloadManager() = default;
+    ~HotReloadManager();
+    HotReloadManager(const HotReloadManager&) = delete;
+    HotReloadManager& operator=(const HotReloadManager&) = delete;
+
+    struct ConfigUpdate {
+        std::string filename;
+        ConfigLoader::Sections sections;
+    };
+
+    struct TextureUpdate {
+        std::string name;                                // ResourceManager key (file name)
+        sf::Image image;
+    };
+
+    void onFileChanged(const std::filesystem::path& path); // Watcher thread
+
+    FileWatcher m_watcher;
+
+    std::mutex m_mutex;                                  // Guards the update lists
+    std::vector<ConfigUpdate> m_configUpdates;
+    std::vector<TextureUpdate> m_textureUpdates;
+};
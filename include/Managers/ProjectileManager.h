@@ -18,7 +18,7 @@ public:
     ProjectileManager& operator=(const ProjectileManager&) = delete;
 
     void update(float dt) override;
-    void draw(sf::RenderWindow& window) const override;
+    void draw(sf::RenderTarget& window) const override;
 
     void fireProjectile(GameTypes::ProjectileType type, int damage, Robot* target, SquadMember* source = nullptr);
     void fireProjectile(GameTypes::ProjectileType type, int damage, const sf::Vector2f& targetPos, SquadMember* source = nullptr);
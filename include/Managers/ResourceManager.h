@@ -1,18 +1,56 @@
 #pragma once
 #include "Core/Constants.h"
+#include "Graphics/TextureVariantCache.h"
+#include "Managers/AssetIds.h"
+#include "Managers/TextureHandle.h"
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <stdexcept>
 
+// Sprite sheet packed into an atlas page by the AtlasPacker tool
+struct AtlasRegion {
+    std::string pageTexture;                       // Texture name of the atlas page
+    sf::IntRect bounds;                            // Whole sheet inside the page
+    std::vector<sf::IntRect> frames;               // Frame rects in page coordinates
+};
+
+// Bytes held by loaded assets, as reported by getMemoryUsage()
+struct ResourceMemoryUsage {
+    size_t textureBytes = 0;                       // width * height * 4 per texture
+    size_t fontBytes = 0;                          // Font file data; glyph pages are not counted
+    size_t soundBytes = 0;                         // 16-bit samples held by AudioManager
+    size_t total() const { return textureBytes + fontBytes + soundBytes; }
+};
+
+// Textures handed out by reference (getTexture) cannot be tracked, so they are
+// pinned until unloaded explicitly. Textures only held through TextureHandle
+// are unreferenced once the last handle goes away; above the memory budget
+// those are evicted least-recently-used first and reload on their next use.
 class ResourceManager {
 public:
     static ResourceManager& getInstance(); // Singleton access
 
     sf::Texture& getTexture(const std::string& filename);
+    TextureHandle acquireTexture(const std::string& filename);  // Shared handle, loads if needed
+    TextureHandle acquireScaledTexture(const std::string& filename); // Variant sized for the active resolution
+    sf::Vector2u getSourceSize(const std::string& filename);    // Authoring size, whichever variant is loaded
     sf::Font& getFont(const std::string& filename);
+
+    // Id lookups index a slot table instead of hashing the name; see AssetIds.h
+    TextureId getTextureId(const std::string& filename);
+    FontId getFontId(const std::string& name);
+    sf::Texture& getTexture(TextureId id);
+    TextureHandle acquireTexture(TextureId id);
+    sf::Font& getFont(FontId id);
+
     bool loadTexture(const std::string& name, const std::string& filename);
+    bool loadTextureFromImage(const std::string& name, const sf::Image& image); // Upload a decoded image
+    bool reloadTexture(const std::string& name, const sf::Image& image);       // In place; false if not loaded
     bool loadFont(const std::string& name, const std::string& filename);
     bool hasTexture(const std::string& name) const;
    
@@ -21,25 +59,87 @@ public:
     void unloadFont(const std::string& name);
     void unloadAll();
 
-    void loadTextureAtlas(const std::string& atlasName, const std::string& filename);
+    // Packed atlas support (metadata written by tools/AtlasPacker)
+    bool loadTextureAtlas(const std::string& filename);
+    bool loadTextureAtlasAsync(const std::string& filename);  // Pages through AsyncAssetLoader
+    void discardAtlasPage(const std::string& page);          // Drop regions of a page that failed
+    bool hasAtlasRegion(const std::string& name) const;
+    const AtlasRegion* getAtlasRegion(const std::string& name) const;
 
     void preloadGameAssets();
     void preloadMenuAssets();
     void preloadAnimationAssets();
+    void preloadAllAssetsAsync();                  // Queue startup textures on AsyncAssetLoader
 
     size_t getTextureCount() const;
     size_t getFontCount() const;
 
     size_t getTotalMemoryUsage() const;
+    ResourceMemoryUsage getMemoryUsage() const;
+    size_t getTextureBytes(const std::string& name) const;    // 0 if not loaded
+    bool isTextureReferenced(const std::string& name) const;  // Borrowed or held by a handle
+
+    // Memory budget (0 = unlimited); enforced at state transitions
+    void setMemoryBudget(size_t bytes) { m_memoryBudget = bytes; }
+    size_t getMemoryBudget() const { return m_memoryBudget; }
+    size_t enforceMemoryBudget();                  // Returns bytes evicted
 
 private:
-    ResourceManager() = default;
+    ResourceManager();
     ~ResourceManager() = default;
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
 
-    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> m_textures; // Texture storage
-    std::unordered_map<std::string, std::shared_ptr<sf::Font>> m_fonts;       // Font storage
+    struct CachedTexture {
+        std::shared_ptr<sf::Texture> texture;
+        size_t bytes = 0;
+        std::uint64_t lastUse = 0;                 // m_useClock at the last get/acquire
+        bool borrowed = false;                     // Handed out by reference; never evicted
+    };
+
+    struct CachedFont {
+        std::shared_ptr<sf::Font> font;
+        size_t sourceBytes = 0;                    // Font file data FreeType reads from
+    };
+
+    std::unordered_map<std::string, CachedTexture> m_textures;                // Texture storage
+    std::unordered_map<std::string, CachedFont> m_fonts;                      // Font storage
+    std::unordered_map<std::string, AtlasRegion> m_atlasRegions;              // Packed sheet lookup
+
+    // Id -> cache entry while loaded; map nodes stay put until erased
+    struct TextureSlot {
+        std::string name;
+        CachedTexture* cached = nullptr;
+    };
+    struct FontSlot {
+        std::string name;
+        std::string file;                          // Loaded from here on first use
+        CachedFont* cached = nullptr;
+    };
+    std::vector<TextureSlot> m_textureSlots;                                  // Indexed by TextureId
+    std::vector<FontSlot> m_fontSlots;                                        // Indexed by FontId
+    std::unordered_map<std::string, TextureId> m_textureIds;
+    std::unordered_map<std::string, FontId> m_fontIds;
+    sf::Texture m_emptyTexture;                    // Returned for failed loads and invalid ids; never cached
+
+    std::unordered_map<std::string, TextureVariantCache::Variant> m_variants; // By source file
+    sf::Vector2u m_variantResolution;              // Resolution m_variants were picked for
+
+    std::uint64_t m_useClock = 0;
+    size_t m_textureBytes = 0;                     // Sum of CachedTexture::bytes
+    size_t m_memoryBudget = 0;
+
+    void storeTexture(const std::string& name, std::shared_ptr<sf::Texture> texture);
+    FontId registerFont(const std::string& name, const std::string& file);
+    void clearTextureSlot(const std::string& name);
+    const TextureVariantCache::Variant& selectVariant(const std::string& filename);
+
+    void loadSheet(const std::string& filename);   // Load sheet unless an atlas provides it
+
+    bool parseTextureAtlas(const std::string& filename, std::vector<std::string>& pages,
+        std::unordered_map<std::string, AtlasRegion>& regions) const;
+    void commitAtlasRegions(const std::vector<std::string>& pages,
+        std::unordered_map<std::string, AtlasRegion>& regions);
 
     // Generic resource loading helper
     template<typename T>
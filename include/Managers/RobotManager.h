@@ -17,7 +17,7 @@ public:
     virtual ~RobotManager() = default; // Destructor
 
     void update(float dt) override;               // Update robots
-    void draw(sf::RenderWindow& window) const override; // Render robots
+    void draw(sf::RenderTarget& window) const override; // Render robots
 
     void spawnRobot(GameTypes::RobotType type, int lane = -1); // Spawn robot of specific type
     const std::vector<std::unique_ptr<Robot>>& getRobots() const; // Get list of robots
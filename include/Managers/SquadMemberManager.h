@@ -20,7 +20,7 @@ public:
     virtual ~SquadMemberManager() = default;
 
     void update(float dt) override;
-    void draw(sf::RenderWindow& window) const override;
+    void draw(sf::RenderTarget& window) const override;
 
     // Unit placement
     bool canPlaceUnit(GameTypes::SquadMemberType type, int lane, int gridX) const;
@@ -0,0 +1,30 @@
+// ================================
+// include/Managers/TextureHandle.h - Shared reference to a cached texture
+// ================================
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+
+// Ref-counted handle to a texture owned by ResourceManager.
+// Copying a handle shares the GPU texture instead of duplicating it.
+class TextureHandle {
+public:
+    TextureHandle() = default;
+    explicit TextureHandle(std::shared_ptr<sf::Texture> texture) : m_texture(std::move(texture)) {}
+
+    const sf::Texture& get() const { return m_texture ? *m_texture : emptyTexture(); } // Texture or empty fallback
+    const sf::Texture& operator*() const { return get(); }
+    const sf::Texture* operator->() const { return &get(); }
+
+    explicit operator bool() const { return m_texture != nullptr; }  // True if a texture is bound
+    void reset() { m_texture.reset(); }                              // Release this reference
+    long useCount() const { return m_texture.use_count(); }          // Shared references (incl. cache)
+
+private:
+    static const sf::Texture& emptyTexture() {
+        static const sf::Texture empty;
+        return empty;
+    }
+
+    std::shared_ptr<sf::Texture> m_texture;
+};
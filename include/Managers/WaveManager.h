@@ -54,7 +54,7 @@ public:
     bool isCountdownActive() const;
     float getCountdownTime() const;
 
-    void renderCountdown(sf::RenderWindow& window);
+    void renderCountdown(sf::RenderTarget& window);
     bool isShowingCountdown() const;
 
     // Callbacks for game events
@@ -5,6 +5,7 @@
 
 #include "States/IState.h"
 #include "UI/Button.h"
+#include "Managers/TextureHandle.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <vector>
@@ -33,7 +34,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -52,6 +53,7 @@ private:
     float m_timeElapsed = 0.0f;                              // Time elapsed before defeat
 
     // UI Elements
+    TextureHandle m_backgroundTexture;                       // Resolution-sized level_bg
     sf::Sprite m_backgroundSprite;                           // Defeat background
     sf::Text m_statsText;                                    // Statistics display
     sf::Text m_tipText;                                      // Helpful tips and encouragement
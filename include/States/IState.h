@@ -15,7 +15,7 @@ public:
     // Core State Interface (must be implemented by all states)
     virtual void handleEvent(const sf::Event& event) = 0;   // Process input events
     virtual void update(float dt) = 0;                      // Update state logic
-    virtual void render(sf::RenderWindow& window) = 0;      // Render state visuals
+    virtual void render(sf::RenderTarget& window) = 0;      // Render state visuals
 
     // State Lifecycle Hooks (optional overrides)
     virtual void onEnter() {}                               // Called when state becomes active
@@ -5,6 +5,7 @@
 #include "States/IState.h"
 #include <SFML/Graphics.hpp>
 #include "UI/Button.h"
+#include "Managers/TextureHandle.h"
 #include <vector>
 #include <memory>
 
@@ -20,7 +21,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -36,20 +37,20 @@ private:
     std::vector<sf::Vector2f> m_levelPositions;             // Positions for level buttons on map
 
     // Multi-Part Background System (stitched panoramic background)
-    sf::Texture m_leftTexture;                              // Left section of background
-    sf::Texture m_middleTexture;                            // Middle section of background
-    sf::Texture m_rightTexture;                             // Right section of background
+    TextureHandle m_leftTexture;                            // Left section of background
+    TextureHandle m_middleTexture;                          // Middle section of background
+    TextureHandle m_rightTexture;                           // Right section of background
     sf::Sprite m_leftBackground;                            // Left background sprite
     sf::Sprite m_middleBackground;                          // Middle background sprite
     sf::Sprite m_rightBackground;                           // Right background sprite
 
     // Decorative Elements
-    sf::Texture m_warningTapeTexture;                       // Warning tape texture
+    TextureHandle m_warningTapeTexture;                     // Warning tape texture
     sf::Sprite m_warningTapeTop;                            // Top warning tape decoration
     sf::Sprite m_warningTapeBottom;                         // Bottom warning tape decoration
 
     // Navigation Elements
-    sf::Texture m_backToMenuTexture;                        // Back button texture
+    TextureHandle m_backToMenuTexture;                      // Back button texture
     sf::Sprite m_backToMenuSprite;                          // Back button sprite
     sf::FloatRect m_backToMenuBounds;                       // Back button collision bounds
 
@@ -8,6 +8,7 @@
 #include "States/StateMachine.h"
 #include "Core/Game.h"
 #include "UI/Button.h"
+#include "Managers/TextureHandle.h"
 #include <vector>
 #include <memory>
 
@@ -24,7 +25,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -43,7 +44,7 @@ private:
 
     // Background System
     sf::Sprite m_backgroundSprite;                          // Background image sprite
-    sf::Texture m_backgroundTexture;                        // Background texture
+    TextureHandle m_backgroundTexture;                      // Resolution-sized background texture
     sf::RectangleShape m_backgroundOverlay;                 // Semi-transparent overlay for text readability
 
     // Menu Navigation State
@@ -68,6 +69,6 @@ private:
     void updateButtonHover(const sf::Vector2f& mousePos);   // Handle mouse hover effects
 
     // Rendering Methods
-    void renderBackground(sf::RenderWindow& window);        // Render background elements
-    void renderUI(sf::RenderWindow& window);                // Render UI elements
+    void renderBackground(sf::RenderTarget& window);        // Render background elements
+    void renderUI(sf::RenderTarget& window);                // Render UI elements
 };
\ No newline at end of file
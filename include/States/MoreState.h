@@ -31,7 +31,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
 private:
     // Core system references
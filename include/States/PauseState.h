@@ -6,6 +6,7 @@
 #include "States/IState.h"
 #include "Core/Constants.h"
 #include "UI/Button.h"
+#include "Managers/TextureHandle.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
@@ -22,7 +23,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -39,6 +40,7 @@ private:
     // UI Elements
     std::vector<std::unique_ptr<Button>> m_buttons;    // Pause menu buttons
     sf::Text m_pauseTitle;                             // "GAME PAUSED" title
+    TextureHandle m_backgroundTexture;                 // Resolution-sized level_bg
     sf::Sprite m_backgroundSprite;                     // Semi-transparent overlay
 
     // Navigation system
@@ -55,6 +57,6 @@ private:
     void setupButtons();                                      // Create and position buttons
     void updateButtonSelection(int direction);                // Handle keyboard navigation
     void updateButtonHover(const sf::Vector2f& mousePos);     // Handle mouse hover
-    void renderOverlay(sf::RenderWindow& window);             // Render semi-transparent background
-    void renderMenu(sf::RenderWindow& window);                // Render pause menu content
+    void renderOverlay(sf::RenderTarget& window);             // Render semi-transparent background
+    void renderMenu(sf::RenderTarget& window);                // Render pause menu content
 };
\ No newline at end of file
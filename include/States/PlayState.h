@@ -9,6 +9,7 @@
 #include "Core/Timer.h"
 #include "Commands/CommandManager.h"
 #include "Entities/Projectiles/Bomb.h"
+#include "Managers/TextureHandle.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
@@ -26,7 +27,7 @@ public:
     // Core state interface - handles events, updates game logic, and renders
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle - setup and cleanup
     void onEnter() override;
@@ -41,6 +42,13 @@ private:
     std::unique_ptr<GridRenderer> m_gridRenderer;    // Renders placement grid
     std::unique_ptr<CommandManager> m_commandManager; // Handles undo/redo system
 
+    // Cached static battlefield layer (background + grid slots)
+    sf::RenderTexture m_staticLayer;                 // Baked background and grid
+    sf::Sprite m_staticLayerSprite;                  // Blits the baked layer
+    sf::Vector2u m_staticLayerSize;                  // Size the layer was baked at
+    unsigned int m_staticLayerRevision = 0;          // Grid revision the layer was baked at
+    bool m_staticLayerBaked = false;                 // False if render texture unavailable
+
     // External references
     Game* m_game;
     StateMachine* m_machine;
@@ -58,31 +66,31 @@ private:
     // Hover-based locked message system for sniper
     bool m_isHoveringLockedSniper = false;           // Track mouse hover state
     float m_lockedMessageAlpha = 0.0f;               // Current message transparency
-    sf::Texture m_lockedMessageTexture;
+    TextureHandle m_lockedMessageTexture;
     static constexpr float FADE_SPEED = 512.0f;      // Fade speed (alpha per second)
 
     // UI Elements - textures and positioning
-    std::vector<sf::Texture> m_unitTextures;         // Unit selection icons
+    std::vector<TextureHandle> m_unitTextures;       // Unit selection icons
     std::vector<int> m_unitCosts;                    // Cost of each unit type
     std::vector<sf::FloatRect> m_unitIconBounds;     // Click areas for units
 
     sf::FloatRect m_bombIconBounds;
-    sf::Texture m_coinUITexture;
+    TextureHandle m_coinUITexture;
     sf::Sprite m_coinUISprite;
 
     // Command system UI
-    sf::Texture m_undoTexture;
-    sf::Texture m_redoTexture;
+    TextureHandle m_undoTexture;
+    TextureHandle m_redoTexture;
     sf::FloatRect m_undoIconBounds;
     sf::FloatRect m_redoIconBounds;
 
     // Level display
-    sf::Texture m_levelSelectTexture;
+    TextureHandle m_levelSelectTexture;
     sf::Sprite m_levelSelectSprite;
     sf::FloatRect m_levelSelectBounds;
 
     // HealthPack system
-    sf::Texture m_healthPackTexture;
+    TextureHandle m_healthPackTexture;
     sf::FloatRect m_healthPackIconBounds;
     bool m_healthPackMode = false;
 
@@ -106,16 +114,18 @@ private:
     void startNewGame();                            // Initialize new game session
 
     // Rendering methods - draw all UI and game elements
-    void renderBackground(sf::RenderWindow& window);
-    void renderGameContent(sf::RenderWindow& window);
-    void renderUI(sf::RenderWindow& window);
-    void renderUnitSelectionIcons(sf::RenderWindow& window);
-    void renderSpecialIcons(sf::RenderWindow& window);
-    void renderHealthPackIcon(sf::RenderWindow& window);
-    void renderCoinDisplay(sf::RenderWindow& window);
-    void renderCommandIcons(sf::RenderWindow& window);
-    void renderLevelSelect(sf::RenderWindow& window);
-    void renderLockedMessage(sf::RenderWindow& window);
+    void renderBackground(sf::RenderTarget& window);
+    void bakeStaticLayer(const sf::Vector2u& size);
+    void drawStaticLayer(sf::RenderTarget& target, const sf::Vector2u& size) const;
+    void renderGameContent(sf::RenderTarget& window);
+    void renderUI(sf::RenderTarget& window);
+    void renderUnitSelectionIcons(sf::RenderTarget& window);
+    void renderSpecialIcons(sf::RenderTarget& window);
+    void renderHealthPackIcon(sf::RenderTarget& window);
+    void renderCoinDisplay(sf::RenderTarget& window);
+    void renderCommandIcons(sf::RenderTarget& window);
+    void renderLevelSelect(sf::RenderTarget& window);
+    void renderLockedMessage(sf::RenderTarget& window);
 
     // Helper methods
     float calculateMessageAlpha(float elapsedTime) const; // For coin message fade effect
@@ -6,6 +6,7 @@
 #include "States/IState.h"
 #include "UI/Button.h"
 #include "UI/Slider.h"
+#include "Managers/TextureHandle.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
@@ -22,7 +23,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -35,6 +36,7 @@ private:
 
     // UI Elements
     sf::Text m_titleText;                                     // "SETTINGS" title
+    TextureHandle m_backgroundTexture;                        // Resolution-sized level_bg
     sf::Sprite m_backgroundSprite;                            // Background image
     std::vector<std::unique_ptr<Button>> m_actionButtons;     // Back/Apply buttons
     std::vector<std::unique_ptr<Slider>> m_volumeSliders;     // Volume control sliders
@@ -1,16 +1,15 @@
 // ================================
-// Splash State - State Pattern with Multithreading for Asset Preloading
+// Splash State - State Pattern with Asynchronous Asset Preloading
 // ================================
 #pragma once
 #include "States/IState.h"
+#include "Systems/Subscription.h"
 #include <SFML/Graphics.hpp>
-#include <thread>
-#include <atomic>
 
 class StateMachine;
 class Game;
 
-// Initial loading screen with animated transitions and background asset loading
+// Initial loading screen shown while Game's startup pipeline runs
 class SplashState : public IState {
 public:
     SplashState(Game* game, StateMachine* machine);
@@ -19,7 +18,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -59,10 +58,10 @@ private:
     };
     Phase m_currentPhase = Phase::CreditsIn;
 
-    // Multithreading for Asset Loading
-    std::thread m_loadingThread;                              // Background loading thread
-    std::atomic<bool> m_assetsLoaded{ false };                // Thread-safe loading completion flag
-    std::atomic<bool> m_shouldStopLoading{ false };           // Thread-safe shutdown flag
+    // Asynchronous Asset Loading (Game's StartupPipeline)
+    bool m_assetsLoaded = false;                              // Every startup task finished
+    Subscription m_progressSubscription;                      // Loader progress, delivered on the main thread
+    Subscription m_failureSubscription;                       // Loader errors, delivered on the main thread
 
     // Animation and Setup Methods
     void setupBackground();                                   // Initialize background graphics
@@ -71,12 +70,11 @@ private:
     void updatePhase();                                       // Transition between animation phases
 
     // Background Loading System
-    void startBackgroundLoading();                           // Start asset loading thread
-    void loadAssetsInBackground();                            // Thread function for asset loading
+    void checkLoadingComplete();                              // Poll the startup pipeline
     void transitionToMenu();                                  // Transition to main menu when complete
 
     // Rendering Helpers
-    void renderTextWithAlpha(sf::RenderWindow& window, sf::Text& text, float alpha);  // Render text with fade
+    void renderTextWithAlpha(sf::RenderTarget& window, sf::Text& text, float alpha);  // Render text with fade
     float calculateAlpha();                                   // Calculate current fade alpha value
 
     // Text Positioning
@@ -20,7 +20,7 @@ public:
     // Core Update Loop
     void handleEvent(const sf::Event& event);                // Route events to current state
     void update(float dt);                                   // Update current state
-    void render(sf::RenderWindow& window);                   // Render current state(s)
+    void render(sf::RenderTarget& window);                   // Render current state(s)
 
     // State Stack Management
     void pushState(std::unique_ptr<IState> state);           // Add state to top of stack
@@ -5,6 +5,7 @@
 
 #include "States/IState.h"
 #include "UI/Button.h"
+#include "Managers/TextureHandle.h"
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
 #include <memory>
@@ -26,7 +27,7 @@ public:
     // Core state interface implementation
     void handleEvent(const sf::Event& event) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& window) override;
 
     // State lifecycle management
     void onEnter() override;
@@ -50,6 +51,7 @@ private:
     int m_totalScore = 0;                                    // Final calculated score
 
     // UI Elements
+    TextureHandle m_backgroundTexture;                       // Resolution-sized level_bg
     sf::Sprite m_backgroundSprite;                           // Victory background
     sf::Text m_statsText;                                    // Score and statistics display
     sf::Text m_tipText;                                      // Encouragement or tips
@@ -0,0 +1,20 @@
+// ================================
+// include/Systems/AnimationHandle.h - Integer ids for clips and components
+// ================================
+#pragma once
+#include <cstdint>
+
+// Index into AnimationSystem's clip table, interned once when the clip is created
+using AnimationId = std::uint16_t;
+constexpr AnimationId INVALID_ANIMATION_ID = 0xFFFF;
+
+// Refers to a component in AnimationSystem's dense array. The generation
+// makes a handle go stale once its component is unregistered.
+struct AnimationHandle {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    std::uint32_t index = INVALID_INDEX;                 // Slot index
+    std::uint32_t generation = 0;                        // Slot generation when issued
+
+    bool isValid() const { return index != INVALID_INDEX; }
+};
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Graphics/AnimationComponent.h"
+#include "Systems/AnimationHandle.h"
 #include "Core/Constants.h"
 #include <unordered_map>
 #include <memory>
@@ -21,45 +22,48 @@ public:
     void shutdown();
     void update(float dt);
 
-    // Animation library management
-    bool loadAnimationFromFile(const std::string& filename);
-    void createAnimation(const std::string& name, const Animation& animation);
+    // Animation library management - name lookups are for setup time only
+    bool loadAnimationFromFile(const std::string& filename);     // animations.cfg via its binary cache
+    AnimationId createAnimation(const std::string& name, const Animation& animation);
+    AnimationId getAnimationId(const std::string& name) const;   // INVALID_ANIMATION_ID if unknown
+    const Animation* getAnimation(AnimationId id) const;
     const Animation* getAnimation(const std::string& name) const;
+    const std::string& getAnimationName(AnimationId id) const;
     bool hasAnimation(const std::string& name) const;
 
-    // Entity registration (just assigns AnimationComponents)
-    void registerSquadMember(SquadMember* unit);
-    void registerRobot(Robot* robot);
-    void registerCollectible(Collectible* collectible);
-    void registerProjectile(Projectile* projectile);
+    // Entity registration - returns the handle used by every call below
+    AnimationHandle registerSquadMember(SquadMember* unit);
+    AnimationHandle registerRobot(Robot* robot);
+    AnimationHandle registerCollectible(Collectible* collectible);
+    AnimationHandle registerProjectile(Projectile* projectile);
 
-    void unregisterEntity(void* entity);
+    void unregisterEntity(AnimationHandle handle);
 
     // Quick animation triggers (delegates to AnimationComponent)
-    void playAnimation(void* entity, const std::string& animationName);
-    void playDamageFlash(void* entity);
-    void playUpgradeEffect(SquadMember* unit);
+    bool playAnimation(AnimationHandle handle, AnimationId id);   // False if handle or clip is invalid
+    void playDamageFlash(AnimationHandle handle);
+    void playUpgradeEffect(AnimationHandle handle);
 
     // ✅ NEW: Animation callback support
-    void setAnimationCompleteCallback(void* entity, AnimationComponent::AnimationCallback callback);
+    void setAnimationCompleteCallback(AnimationHandle handle, AnimationComponent::AnimationCallback callback);
 
     // Global control
     void setGlobalSpeed(float speed);
     float getGlobalSpeed() const;
 
-    // Predefined animations creation
-    void createGameAnimations();
-
-    void render(sf::RenderWindow& window);
+    // Submit every animated sprite to the RenderQueue
+    void queueRenderables() const;
 
     // Debug helper
-    void updateEntityPosition(void* entity, const sf::Vector2f& position);
+    void updateEntityPosition(AnimationHandle handle, const sf::Vector2f& position);
 
     // Animation control methods
-    void pauseEntityAnimation(void* entity);
-    void resumeEntityAnimation(void* entity);
-    bool isEntityAnimationPaused(void* entity) const;
-    bool isEntityPlayingAnimation(void* entity, const std::string& animationName) const;
+    void pauseEntityAnimation(AnimationHandle handle);
+    void resumeEntityAnimation(AnimationHandle handle);
+    bool isEntityAnimationPaused(AnimationHandle handle) const;
+    bool isEntityPlayingAnimation(AnimationHandle handle, AnimationId id) const;
+
+    size_t getComponentCount() const { return m_components.size(); }
 
 private:
     AnimationSystem() = default;
@@ -67,15 +71,39 @@ private:
     AnimationSystem(const AnimationSystem&) = delete;
     AnimationSystem& operator=(const AnimationSystem&) = delete;
 
-    std::unordered_map<std::string, std::unique_ptr<Animation>> m_animations;
-    std::unordered_map<void*, std::unique_ptr<AnimationComponent>> m_entityComponents;
+    // Clip table indexed by AnimationId; unique_ptr keeps clip addresses stable
+    std::vector<std::unique_ptr<Animation>> m_clips;
+    std::vector<std::string> m_clipNames;
+    std::unordered_map<std::string, AnimationId> m_clipIds;
+    AnimationId m_upgradeClip = INVALID_ANIMATION_ID;
+
+    // Components packed densely for update/render; handles go through m_slots
+    struct ComponentSlot {
+        std::uint32_t denseIndex = 0;
+        std::uint32_t generation = 0;
+        bool alive = false;
+    };
+    std::vector<AnimationComponent> m_components;
+    std::vector<std::uint32_t> m_denseToSlot;
+    std::vector<ComponentSlot> m_slots;
+    std::vector<std::uint32_t> m_freeSlots;
+
     float m_globalSpeed = 1.0f;
 
+    // Callbacks may register or unregister entities, so they run after the update pass
+    bool m_updating = false;
+    std::vector<AnimationComponent::AnimationCallback> m_firedCallbacks;
+    std::vector<AnimationHandle> m_firedHandles;        // Owner of each fired callback
+    std::vector<AnimationHandle> m_pendingUnregisters;  // Unregistered during the pass
+
+    AnimationHandle addComponent(void* owner, RenderLayer layer);
+    AnimationComponent* resolve(AnimationHandle handle);
+    const AnimationComponent* resolve(AnimationHandle handle) const;
+
     void updateComponents(float dt);
+    void removeComponent(AnimationHandle handle);
 
-    void createRobotAnimations();
-    void createSquadMemberAnimations();
-    void createProjectileAnimations();
-    void createCollectibleAnimations();
-    void createEffectAnimations();
+    bool createSheetAnimation(const std::string& name, const std::string& sheet,
+        int frameCount, float duration, std::uint8_t flags, int frameWidth, int frameHeight,
+        const std::vector<float>& frameDurations);
 };
\ No newline at end of file
@@ -0,0 +1,69 @@
+// ================================
+// include/Systems/EventQueue.h - Preallocated FIFO ring for one event type
+// ================================
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Slots are allocated once up front and reused, so push/pop never touch the
+// heap. A full ring doubles its capacity (with a warning) instead of dropping
+// gameplay events; raise the type's EventQueueCapacity if that shows up.
+template<typename EventType>
+class EventQueue {
+public:
+    explicit EventQueue(size_t capacity)
+        : m_slots(capacity > 0 ? capacity : 1) {
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        if (m_count == m_slots.size()) {
+            grow();
+        }
+        m_slots[(m_head + m_count) % m_slots.size()].emplace(std::forward<Args>(args)...);
+        ++m_count;
+    }
+
+    EventType pop() {                                    // Caller checks empty() first
+        std::optional<EventType>& slot = m_slots[m_head];
+        EventType event = std::move(*slot);
+        slot.reset();
+        m_head = (m_head + 1) % m_slots.size();
+        --m_count;
+        return event;
+    }
+
+    void clear() {                                       // Keeps the allocated slots
+        while (m_count > 0) {
+            m_slots[m_head].reset();
+            m_head = (m_head + 1) % m_slots.size();
+            --m_count;
+        }
+        m_head = 0;
+    }
+
+    bool empty() const { return m_count == 0; }
+    size_t size() const { return m_count; }
+    size_t capacity() const { return m_slots.size(); }
+
+private:
+    void grow() {
+        std::cerr << "EventQueue<" << typeid(EventType).name() << "> full at "
+            << m_slots.size() << " events, growing" << std::endl;
+
+        std::vector<std::optional<EventType>> slots(m_slots.size() * 2);
+        for (size_t i = 0; i < m_count; ++i) {
+            slots[i] = std::move(m_slots[(m_head + i) % m_slots.size()]);
+        }
+        m_slots.swap(slots);
+        m_head = 0;
+    }
+
+    std::vector<std::optional<EventType>> m_slots;
+    size_t m_head = 0;                                   // Oldest queued event
+    size_t m_count = 0;
+};
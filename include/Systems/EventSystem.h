@@ -2,15 +2,31 @@
 // include/Systems/EventSystem.h 
 // ================================
 #pragma once
-#include "Core/Constants.h"
-#include <SFML/Graphics.hpp>
+#include "Core/MpscQueue.h"
+#include "Systems/EventQueue.h"
+#include "Systems/GameEvents.h"
+#include "Systems/Subscription.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
 #include <functional>
-#include <vector>
-#include <unordered_map>
-#include <typeindex>
-#include <memory>
-#include <queue>
+#include <tuple>
 #include <type_traits>
+#include <vector>
+
+// Per-type counters collected while tracing is enabled
+struct EventTypeStats {
+    const char* name = "";
+    std::uint64_t published = 0;                     // Totals since the last reset
+    std::uint64_t handlersInvoked = 0;
+    double handlerMs = 0.0;                          // Wall time inside this type's handlers
+    size_t highWaterMark = 0;                        // Deepest queue in any frame
+
+    std::uint32_t framePublished = 0;                // Last completed frame
+    std::uint32_t frameHandlersInvoked = 0;
+    float frameHandlerMs = 0.0f;
+    size_t frameHighWater = 0;
+};
 
 class EventSystem {
 public:
@@ -23,129 +39,210 @@ public:
     template<typename EventType>
     using EventHandler = std::function<void(const EventType&)>;
 
+    // The handler is removed when the returned token is destroyed or reset
     template<typename EventType>
-    void subscribe(EventHandler<EventType> handler) {
-        static_assert(std::is_class_v<EventType>, "EventType must be a class");
-        auto typeIndex = std::type_index(typeid(EventType));
-        m_handlers[typeIndex].emplace_back([handler = std::move(handler)](const void* event) {
-            handler(*static_cast<const EventType*>(event));
-            });
+    [[nodiscard]] Subscription subscribe(EventHandler<EventType> handler) {
+        std::uint32_t id = m_nextSubscriptionId++;
+        channel<EventType>().handlers.push_back({ id, std::move(handler) });
+        return Subscription(id, &EventSystem::removeHandler<EventType>);
     }
 
-    // ADVANCED: Variadic templates + Perfect forwarding
+    // ADVANCED: Variadic templates + Perfect forwarding - constructed in place in the type's ring
     template<typename EventType, typename... Args>
     void publish(Args&&... args) {
-        static_assert(std::is_class_v<EventType>, "EventType must be a class");
-        auto eventCopy = std::make_unique<EventType>(std::forward<Args>(args)...);
-        m_eventQueue.push({ std::type_index(typeid(EventType)), std::move(eventCopy) });
+        auto& eventChannel = channel<EventType>();
+        eventChannel.queue.emplace(std::forward<Args>(args)...);
+        if (m_tracing) traceQueued(eventChannel);
+    }
+
+    // Thread-safe publishing for worker threads (asset loading, audio decode, saving).
+    // Lock-free; the event joins its type's ring at the next processEvents().
+    template<typename EventType, typename... Args>
+    void post(Args&&... args) {
+        static_assert(Channels::template contains<EventType>, "EventType must be listed in GameEventTypes (Systems/GameEvents.h)");
+        m_ingress.push(new IngressEvent<EventType>(std::forward<Args>(args)...));
     }
 
     // Immediate event publishing
     template<typename EventType>
     void publishImmediate(const EventType& event) {
-        static_assert(std::is_class_v<EventType>, "EventType must be a class");
-        auto typeIndex = std::type_index(typeid(EventType));
-        auto it = m_handlers.find(typeIndex);
-        if (it != m_handlers.end()) {
-            for (const auto& handler : it->second) {
-                handler(&event);
-            }
-        }
+        auto& eventChannel = channel<EventType>();
+        if (m_tracing) ++eventChannel.frame.published;
+        ++m_dispatchDepth;
+        callHandlers(eventChannel, event, m_tracing);
+        --m_dispatchDepth;
+        compactHandlers();
     }
 
-    // Process queued events
+    // Process queued events, one batch per event type (main thread only)
     void processEvents();
 
     // Clear all handlers and events
     void clear();
+    void discardQueuedEvents();                          // Drop pending events, keep subscribers
 
     // Statistics
     int getHandlerCount() const;
     int getQueuedEventCount() const;
 
+    // Tracing - off by default; nested publishImmediate time also counts toward the outer handler
+    void setTracingEnabled(bool enabled);
+    bool isTracingEnabled() const { return m_tracing; }
+    std::vector<EventTypeStats> getEventStats() const;   // One entry per registered type
+    bool exportStatsCsv(const std::string& filename) const;
+    void resetStats();
+
 private:
     EventSystem() = default;
-    ~EventSystem() = default;
+    ~EventSystem();
     EventSystem(const EventSystem&) = delete;
     EventSystem& operator=(const EventSystem&) = delete;
 
-    // ADVANCED: Type-erased handler storage
-    using TypeErasedHandler = std::function<void(const void*)>;
-    std::unordered_map<std::type_index, std::vector<TypeErasedHandler>> m_handlers;
-
-    // ADVANCED: Custom deleter for type-erased events
-    struct QueuedEvent {
-        std::type_index type;
-        std::unique_ptr<void, void(*)(void*)> event;
+    template<typename EventType>
+    struct HandlerEntry {
+        std::uint32_t id;
+        EventHandler<EventType> handler;                 // Empty once unsubscribed mid-dispatch
+    };
 
-        template<typename T>
-        QueuedEvent(std::type_index t, std::unique_ptr<T> e)
-            : type(t), event(e.release(), [](void* ptr) { delete static_cast<T*>(ptr); }) {
+    // One preallocated queue and handler list per registered event type
+    template<typename EventType>
+    struct EventChannel {
+        EventChannel() : queue(EventQueueCapacity<EventType>::value) {
+            stats.name = EventTypeName<EventType>::value;
         }
+
+        EventQueue<EventType> queue;
+        std::vector<HandlerEntry<EventType>> handlers;   // Unordered; removal swaps with the last
+        bool hasRemovedHandlers = false;
+
+        struct FrameCounters {
+            std::uint32_t published = 0;
+            std::uint32_t handlersInvoked = 0;
+            double handlerMs = 0.0;
+            size_t highWater = 0;
+        };
+        EventTypeStats stats;
+        FrameCounters frame;                             // Rolled into stats once per processEvents
     };
-    std::queue<QueuedEvent> m_eventQueue;
-};
 
-struct RobotDestroyedEvent {
-    class Robot* robot;
-    sf::Vector2f position;
-    int coinsRewarded;
-    GameTypes::RobotType robotType;
-};
+    template<typename List>
+    struct ChannelStorage;
 
-struct SquadMemberPlacedEvent {
-    class SquadMember* member;
-    int lane;
-    sf::Vector2f position;
-    GameTypes::SquadMemberType memberType;
-};
+    template<typename... EventTypes>
+    struct ChannelStorage<EventTypeList<EventTypes...>> {
+        using Type = std::tuple<EventChannel<EventTypes>...>;
 
-struct WaveStartedEvent {
-    int waveNumber;
-    int totalEnemies;
-    float waveDifficulty;
-};
+        template<typename EventType>
+        static constexpr bool contains = (std::is_same_v<EventType, EventTypes> || ...);
+    };
 
-struct ProjectileHitEvent {
-    class Projectile* projectile;
-    class Robot* target;
-    int damage;
-    sf::Vector2f hitPosition;
-    bool wasCritical;
-};
+    using Channels = ChannelStorage<GameEventTypes>;
 
-struct GameOverEvent {
-    bool victory;
-    int finalScore;
-    int wavesCompleted;
-    float timeElapsed;
-};
+    template<typename EventType>
+    EventChannel<EventType>& channel() {
+        static_assert(Channels::template contains<EventType>, "EventType must be listed in GameEventTypes (Systems/GameEvents.h)");
+        return std::get<EventChannel<EventType>>(m_channels);
+    }
 
-struct BombExplosionEvent {
-    sf::Vector2f position;
-    float explosionRadius;
-    int damage;
+    // Dispatch what was queued before the batch started; events published by
+    // handlers stay in the ring for the next round
+    template<typename EventType>
+    static void dispatchBatch(EventChannel<EventType>& channel, bool tracing) {
+        for (size_t pending = channel.queue.size(); pending > 0 && !channel.queue.empty(); --pending) {
+            EventType event = channel.queue.pop();
+            callHandlers(channel, event, tracing);
+        }
+    }
 
-    BombExplosionEvent(const sf::Vector2f& pos, float radius, int dmg)
-        : position(pos), explosionRadius(radius), damage(dmg) {
+    template<typename EventType>
+    static void callHandlers(EventChannel<EventType>& channel, const EventType& event, bool tracing) {
+        if (!tracing) {
+            for (size_t i = 0; i < channel.handlers.size(); ++i) {
+                if (channel.handlers[i].handler) {
+                    channel.handlers[i].handler(event);
+                }
+            }
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < channel.handlers.size(); ++i) {
+            if (channel.handlers[i].handler) {
+                channel.handlers[i].handler(event);
+                ++channel.frame.handlersInvoked;
+            }
+        }
+        channel.frame.handlerMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    template<typename EventType>
+    static void traceQueued(EventChannel<EventType>& channel) {
+        ++channel.frame.published;
+        if (channel.queue.size() > channel.frame.highWater) {
+            channel.frame.highWater = channel.queue.size();
+        }
     }
-};
 
-// ✅ UPDATED: Drop Events with robot reward values
-struct CoinDropEvent {
-    sf::Vector2f position;
-    int robotRewardValue;  // ✅ CHANGED: Use robot's actual reward value
+    void rollFrameStats();                               // Close the frame's counters
 
-    CoinDropEvent(const sf::Vector2f& pos, int rewardValue)
-        : position(pos), robotRewardValue(rewardValue) {
+    // Called through a Subscription token. While dispatching, the entry is only
+    // emptied so handler indices stay put; compactHandlers() swap-removes it later.
+    template<typename EventType>
+    static void removeHandler(std::uint32_t id) {
+        EventSystem& system = getInstance();
+        auto& channel = system.channel<EventType>();
+        for (size_t i = 0; i < channel.handlers.size(); ++i) {
+            if (channel.handlers[i].id != id) continue;
+
+            if (system.m_dispatchDepth > 0) {
+                channel.handlers[i].handler = nullptr;
+                channel.hasRemovedHandlers = true;
+            }
+            else {
+                channel.handlers[i] = std::move(channel.handlers.back());
+                channel.handlers.pop_back();
+            }
+            return;
+        }
     }
-};
 
-struct HealthPackDropEvent {
-    sf::Vector2f position;
-    int healAmount;
+    void compactHandlers();                              // Swap-remove handlers emptied mid-dispatch
+
+    // Cross-thread ingress - nodes are allocated by the posting thread and
+    // freed on the main thread once their event is moved into the ring
+    struct IngressNode : MpscNode {
+        using DeliverFunction = void(*)(EventSystem* system, IngressNode* node);
+        explicit IngressNode(DeliverFunction deliverFunction) : deliver(deliverFunction) {}
+        DeliverFunction deliver;                         // nullptr system = discard
+    };
+
+    template<typename EventType>
+    struct IngressEvent : IngressNode {
+        template<typename... Args>
+        explicit IngressEvent(Args&&... args)
+            : IngressNode(&EventSystem::deliverIngress<EventType>), event{ std::forward<Args>(args)... } {
+        }
+        EventType event;
+    };
 
-    HealthPackDropEvent(const sf::Vector2f& pos, int heal = 50)
-        : position(pos), healAmount(heal) {
+    template<typename EventType>
+    static void deliverIngress(EventSystem* system, IngressNode* node) {
+        auto* typed = static_cast<IngressEvent<EventType>*>(node);
+        if (system) {
+            auto& eventChannel = system->channel<EventType>();
+            eventChannel.queue.emplace(std::move(typed->event));
+            if (system->m_tracing) traceQueued(eventChannel);
+        }
+        delete typed;
     }
-};
\ No newline at end of file
+
+    void drainIngress();                                 // Move posted events into their rings
+    void discardIngress();                               // Free posted events without delivering
+
+    MpscQueue m_ingress;
+
+    Channels::Type m_channels;
+    std::uint32_t m_nextSubscriptionId = 1;
+    int m_dispatchDepth = 0;                             // Nested processEvents/publishImmediate calls
+    bool m_tracing = false;
+};
@@ -0,0 +1,132 @@
+// ================================
+// include/Systems/GameEvents.h - Event payloads and the compile-time event registry
+// ================================
+#pragma once
+#include "Core/Constants.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+
+struct RobotDestroyedEvent {
+    class Robot* robot;
+    sf::Vector2f position;
+    int coinsRewarded;
+    GameTypes::RobotType robotType;
+};
+
+struct SquadMemberPlacedEvent {
+    class SquadMember* member;
+    int lane;
+    sf::Vector2f position;
+    GameTypes::SquadMemberType memberType;
+};
+
+struct WaveStartedEvent {
+    int waveNumber;
+    int totalEnemies;
+    float waveDifficulty;
+};
+
+struct ProjectileHitEvent {
+    class Projectile* projectile;
+    class Robot* target;
+    int damage;
+    sf::Vector2f hitPosition;
+    bool wasCritical;
+};
+
+struct GameOverEvent {
+    bool victory;
+    int finalScore;
+    int wavesCompleted;
+    float timeElapsed;
+};
+
+struct BombExplosionEvent {
+    sf::Vector2f position;
+    float explosionRadius;
+    int damage;
+
+    BombExplosionEvent(const sf::Vector2f& pos, float radius, int dmg)
+        : position(pos), explosionRadius(radius), damage(dmg) {
+    }
+};
+
+// ✅ UPDATED: Drop Events with robot reward values
+struct CoinDropEvent {
+    sf::Vector2f position;
+    int robotRewardValue;  // ✅ CHANGED: Use robot's actual reward value
+
+    CoinDropEvent(const sf::Vector2f& pos, int rewardValue)
+        : position(pos), robotRewardValue(rewardValue) {
+    }
+};
+
+struct HealthPackDropEvent {
+    sf::Vector2f position;
+    int healAmount;
+
+    HealthPackDropEvent(const sf::Vector2f& pos, int heal = 50)
+        : position(pos), healAmount(heal) {
+    }
+};
+
+// Posted from the background loader thread through EventSystem::post
+struct AssetLoadProgressEvent {
+    int completedSteps;
+    int totalSteps;
+};
+
+struct AssetLoadFailedEvent {
+    std::string message;
+};
+
+// Published by HotReloadManager after an edited .cfg is merged into ConfigLoader
+struct ConfigReloadedEvent {
+    std::string filename;
+};
+
+// ================================
+// Event registry - every publishable type must be listed here
+// ================================
+template<typename... EventTypes>
+struct EventTypeList {};
+
+using GameEventTypes = EventTypeList<
+    RobotDestroyedEvent,
+    SquadMemberPlacedEvent,
+    WaveStartedEvent,
+    ProjectileHitEvent,
+    GameOverEvent,
+    BombExplosionEvent,
+    CoinDropEvent,
+    HealthPackDropEvent,
+    AssetLoadProgressEvent,
+    AssetLoadFailedEvent,
+    ConfigReloadedEvent
+>;
+
+// Display names for EventSystem tracing (overlay and CSV)
+template<typename EventType>
+struct EventTypeName { static constexpr const char* value = "UnnamedEvent"; };
+
+template<> struct EventTypeName<RobotDestroyedEvent> { static constexpr const char* value = "RobotDestroyed"; };
+template<> struct EventTypeName<SquadMemberPlacedEvent> { static constexpr const char* value = "SquadMemberPlaced"; };
+template<> struct EventTypeName<WaveStartedEvent> { static constexpr const char* value = "WaveStarted"; };
+template<> struct EventTypeName<ProjectileHitEvent> { static constexpr const char* value = "ProjectileHit"; };
+template<> struct EventTypeName<GameOverEvent> { static constexpr const char* value = "GameOver"; };
+template<> struct EventTypeName<BombExplosionEvent> { static constexpr const char* value = "BombExplosion"; };
+template<> struct EventTypeName<CoinDropEvent> { static constexpr const char* value = "CoinDrop"; };
+template<> struct EventTypeName<HealthPackDropEvent> { static constexpr const char* value = "HealthPackDrop"; };
+template<> struct EventTypeName<AssetLoadProgressEvent> { static constexpr const char* value = "AssetLoadProgress"; };
+template<> struct EventTypeName<AssetLoadFailedEvent> { static constexpr const char* value = "AssetLoadFailed"; };
+template<> struct EventTypeName<ConfigReloadedEvent> { static constexpr const char* value = "ConfigReloaded"; };
+
+// Ring slots preallocated per type; bursty types get room for a whole wave
+template<typename EventType>
+struct EventQueueCapacity { static constexpr size_t value = 32; };
+
+template<> struct EventQueueCapacity<RobotDestroyedEvent> { static constexpr size_t value = 256; };
+template<> struct EventQueueCapacity<CoinDropEvent> { static constexpr size_t value = 256; };
+template<> struct EventQueueCapacity<HealthPackDropEvent> { static constexpr size_t value = 64; };
+template<> struct EventQueueCapacity<BombExplosionEvent> { static constexpr size_t value = 64; };
@@ -0,0 +1,47 @@
+// ================================
+// include/Systems/Subscription.h - RAII token for an EventSystem handler
+// ================================
+#pragma once
+#include <cstdint>
+#include <utility>
+
+// Returned by EventSystem::subscribe; the handler stays registered exactly as
+// long as the token lives. Move-only, so an owner can keep tokens in a vector.
+class Subscription {
+public:
+    using RemoveFunction = void(*)(std::uint32_t id);
+
+    Subscription() = default;
+    Subscription(std::uint32_t id, RemoveFunction remove) : m_id(id), m_remove(remove) {}
+    ~Subscription() { reset(); }
+
+    Subscription(const Subscription&) = delete;
+    Subscription& operator=(const Subscription&) = delete;
+
+    Subscription(Subscription&& other) noexcept
+        : m_id(std::exchange(other.m_id, 0)), m_remove(std::exchange(other.m_remove, nullptr)) {
+    }
+
+    Subscription& operator=(Subscription&& other) noexcept {
+        if (this != &other) {
+            reset();
+            m_id = std::exchange(other.m_id, 0);
+            m_remove = std::exchange(other.m_remove, nullptr);
+        }
+        return *this;
+    }
+
+    void reset() {                                       // Unsubscribe now; safe to call twice
+        if (m_remove) {
+            m_remove(m_id);
+        }
+        m_id = 0;
+        m_remove = nullptr;
+    }
+
+    bool isActive() const { return m_remove != nullptr; }
+
+private:
+    std::uint32_t m_id = 0;
+    RemoveFunction m_remove = nullptr;                   // Typed remover for the handler's channel
+};
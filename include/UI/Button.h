@@ -31,7 +31,7 @@ public:
 
     // Core functionality
     void update(float dt);
-    void draw(sf::RenderWindow& window) const;
+    void draw(sf::RenderTarget& window) const;
     void handleEvent(const sf::Event& event);
 
     // Properties
@@ -118,8 +118,8 @@ private:
     void playClickSound();
 
     // Rendering helpers
-    void renderBackground(sf::RenderWindow& window) const;
-    void renderGlow(sf::RenderWindow& window) const;
-    void renderText(sf::RenderWindow& window) const;
-    void renderTexture(sf::RenderWindow& window) const;
+    void renderBackground(sf::RenderTarget& window) const;
+    void renderGlow(sf::RenderTarget& window) const;
+    void renderText(sf::RenderTarget& window) const;
+    void renderTexture(sf::RenderTarget& window) const;
 };
\ No newline at end of file
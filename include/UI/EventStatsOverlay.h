@@ -0,0 +1,27 @@
+// ================================
+// include/UI/EventStatsOverlay.h - Debug panel for EventSystem tracing (F3 toggle, F4 CSV)
+// ================================
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+
+class EventStatsOverlay {
+public:
+    EventStatsOverlay();
+
+    bool handleEvent(const sf::Event& event);            // True if the key was consumed
+    void draw(sf::RenderTarget& target);                 // No-op while hidden
+
+    bool isVisible() const { return m_visible; }
+
+private:
+    void refreshText();                                  // Rebuild the table from current stats
+
+    bool m_visible = false;
+    sf::Text m_text;
+    sf::RectangleShape m_background;
+    sf::Clock m_refreshClock;                            // Throttles text rebuilds
+
+    static constexpr float REFRESH_INTERVAL = 0.25f;
+    static constexpr const char* CSV_FILE = "event_stats.csv";
+};
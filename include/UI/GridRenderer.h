@@ -19,7 +19,8 @@ public:
 
     // Core rendering
     void update(float dt);
-    void draw(sf::RenderWindow& window) const;
+    void draw(sf::RenderTarget& target) const;
+    unsigned int getRevision() const { return m_revision; } // Bumped when the grid's look changes
 
     // Grid utilities
     sf::Vector2i getGridPosition(const sf::Vector2f& mousePos) const;
@@ -46,4 +47,5 @@ private:
     sf::Vector2f m_cellSize = sf::Vector2f(GameConstants::GRID_CELL_WIDTH, GameConstants::GRID_CELL_HEIGHT);
 
     std::unordered_set<sf::Vector2i, Vector2iHash> m_blockedCells;
+    unsigned int m_revision = 0;  // Bumped by anything that changes the drawn grid
 };
\ No newline at end of file
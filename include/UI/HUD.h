@@ -16,7 +16,7 @@ public:
 
     // Core functionality
     void update(float dt);
-    void draw(sf::RenderWindow& window) const;
+    void draw(sf::RenderTarget& window) const;
     void handleEvent(const sf::Event& event);
 
     // Game manager integration
@@ -122,8 +122,8 @@ private:
     void updateVisualFeedback(float dt);
     void updateRangeIndicators(float dt);
     void onUnitButtonClicked(GameTypes::SquadMemberType type);
-    void renderUnitInfo(sf::RenderWindow& window) const;
-    void renderVisualFeedback(sf::RenderWindow& window) const;
-    void renderRangeIndicators(sf::RenderWindow& window) const;
-    void renderTargetingVisualization(sf::RenderWindow& window) const;
+    void renderUnitInfo(sf::RenderTarget& window) const;
+    void renderVisualFeedback(sf::RenderTarget& window) const;
+    void renderRangeIndicators(sf::RenderTarget& window) const;
+    void renderTargetingVisualization(sf::RenderTarget& window) const;
 };
\ No newline at end of file
@@ -12,7 +12,7 @@ public:
 
     void handleEvent(const sf::Event& event);
     void update(float dt);
-    void render(sf::RenderWindow& window);
+    void render(sf::RenderTarget& window);
 
     float getValue() const;
     void setValue(float value);  
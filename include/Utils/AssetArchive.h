@@ -0,0 +1,42 @@
+// ================================
+// include/Utils/AssetArchive.h - Memory-mapped packed asset archive (assets.pak)
+// ================================
+#pragma once
+#include "Utils/AssetArchiveFormat.h"
+#include "Utils/MappedFile.h"
+#include <cstddef>
+#include <string>
+
+// Mounted once at startup, then read-only: lookups are safe from any thread.
+// Returned views point straight into the mapping and stay valid for the
+// process lifetime, as sf::Font and sf::Music require for loadFromMemory.
+class AssetArchive {
+public:
+    struct View {
+        const void* data = nullptr;
+        size_t size = 0;
+        AssetArchiveFormat::AssetType type = AssetArchiveFormat::AssetType::Other;
+        explicit operator bool() const { return data != nullptr; }
+    };
+
+    static AssetArchive& getInstance();                  // Singleton access
+
+    bool mount(const std::string& filename);             // False if missing or invalid; loose files are used then
+    bool isMounted() const { return m_entries != nullptr; }
+    size_t getEntryCount() const;
+
+    View find(const std::string& name) const;            // Empty view if not packed
+
+private:
+    AssetArchive() = default;
+    ~AssetArchive() = default;
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    bool validate() const;
+
+    MappedFile m_mapping;
+    const AssetArchiveFormat::Header* m_header = nullptr;
+    const AssetArchiveFormat::Entry* m_entries = nullptr;
+    const char* m_names = nullptr;
+};
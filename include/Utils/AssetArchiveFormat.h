@@ -0,0 +1,35 @@
+// ================================
+// include/Utils/AssetArchiveFormat.h - On-disk layout of assets.pak (shared with tools/AssetPacker)
+// ================================
+#pragma once
+#include <cstdint>
+
+// [Header][Entry x entryCount, sorted by name][name blob][padding][file data...]
+// All offsets are from the start of the archive; file data is 16-byte aligned.
+namespace AssetArchiveFormat {
+    constexpr char MAGIC[4] = { 'S', 'P', 'A', 'K' };
+    constexpr std::uint32_t VERSION = 1;
+    constexpr std::uint64_t DATA_ALIGNMENT = 16;
+
+    enum class AssetType : std::uint32_t {
+        Texture = 0,                                     // .png .jpg .bmp
+        Font,                                            // .ttf .otf
+        Sound,                                           // .wav
+        Music,                                           // .ogg
+        Other
+    };
+
+    struct Header {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t nameBytes;                         // Size of the NUL-terminated name blob
+    };
+
+    struct Entry {
+        std::uint32_t nameOffset;                        // Into the name blob
+        AssetType type;
+        std::uint64_t offset;                            // Start of the file's bytes
+        std::uint64_t size;
+    };
+}
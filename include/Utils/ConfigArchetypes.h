@@ -0,0 +1,47 @@
+// ================================
+// include/Utils/ConfigArchetypes.h - Typed per-type config, compiled from the .cfg sections
+// ================================
+#pragma once
+#include "Core/Constants.h"
+#include "Managers/AssetIds.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+
+// ConfigLoader rebuilds these whenever its sections change (load, hot-reload
+// merge, clear), so readers get plain fields with defaults already applied.
+// References stay valid; only the values change on a reload.
+
+constexpr size_t ROBOT_TYPE_COUNT = 3;                   // GameTypes::RobotType
+constexpr size_t UNIT_TYPE_COUNT = 3;                    // GameTypes::SquadMemberType
+constexpr size_t PROJECTILE_TYPE_COUNT = 4;              // GameTypes::ProjectileType
+
+// [BasicRobot], [FireRobot], [StealthRobot] in robots.cfg
+struct RobotArchetype {
+    int health = 100;
+    float speed = 50.0f;
+    int damage = 25;
+    int reward = 30;
+    float attackRange = 100.0f;
+    int meleeAttackDamage = 25;                          // Defaults to damage
+    float bulletCooldown = 0.0f;                         // Ranged robots only
+};
+
+// [HeavyGunner], [Sniper], [ShieldBearer] in units.cfg
+struct UnitArchetype {
+    int cost = 40;
+    float range = 200.0f;
+    int health = 100;
+    float attackSpeed = 1.5f;                            // Seconds between attacks
+};
+
+// [SquadBullet], [SniperBullet], [RobotBullet] in projectiles.cfg
+struct ProjectileArchetype {
+    float speed = 400.0f;
+    std::string textureFile;
+    TextureId texture = TextureId::Invalid;              // Resolved from textureFile
+    float scale = 0.03f;
+    sf::Vector2f spawnOffset{ 25.0f, 0.0f };
+    float maxRange = 300.0f;
+    int damage = 25;
+};
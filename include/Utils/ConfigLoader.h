@@ -3,13 +3,17 @@
 // ================================
 #pragma once
 #include "Core/Constants.h"
+#include "Utils/ConfigArchetypes.h"
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 class ConfigLoader {
 public:
+    using Sections = std::unordered_map<std::string, std::unordered_map<std::string, std::string>>;
+
     // Singleton access
     static ConfigLoader& getInstance();
 
@@ -21,6 +25,10 @@ public:
     bool loadFromFile(const std::string& filename);
     void clearConfig();
 
+    // Hot reload: parse on any thread, merge on the main thread
+    static bool parseFile(const std::string& filename, Sections& sections);
+    void mergeSections(const Sections& sections);        // Overwrites matching keys
+
     // Value getters with default fallbacks
     bool getBool(const std::string& section, const std::string& key, bool defaultValue = false) const;
     int getInt(const std::string& section, const std::string& key, int defaultValue = 0) const;
@@ -31,6 +39,11 @@ public:
     bool hasSection(const std::string& section) const;
     bool hasValue(const std::string& section, const std::string& key) const;
 
+    // Typed snapshots for hot paths; see ConfigArchetypes.h
+    const RobotArchetype& getRobotArchetype(GameTypes::RobotType type) const;
+    const UnitArchetype& getUnitArchetype(GameTypes::SquadMemberType type) const;
+    const ProjectileArchetype& getProjectileArchetype(GameTypes::ProjectileType type) const;
+
     // Convenient getters for specific config types
     int getUnitCost(GameTypes::SquadMemberType type) const;
     int getRobotReward(GameTypes::RobotType type) const;
@@ -112,6 +125,7 @@ public:
         int initialCoins;
         int baseHealth;
         int numLanes;
+        int textureBudgetMB;     // 0 = no limit
     };
 
     // Load specific configurations
@@ -130,16 +144,21 @@ public:
     bool hasErrors() const;
 
 private:
-    ConfigLoader() = default;
+    ConfigLoader();
     ~ConfigLoader() = default;
     ConfigLoader(const ConfigLoader&) = delete;
     ConfigLoader& operator=(const ConfigLoader&) = delete;
 
     // Internal storage
-    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_config;
+    Sections m_config;
     mutable std::string m_lastError;
     bool m_initialized = false;
 
+    // Compiled from m_config by compileArchetypes()
+    std::array<RobotArchetype, ROBOT_TYPE_COUNT> m_robotArchetypes;
+    std::array<UnitArchetype, UNIT_TYPE_COUNT> m_unitArchetypes;
+    std::array<ProjectileArchetype, PROJECTILE_TYPE_COUNT> m_projectileArchetypes;
+
     // Track which configs are loaded
     std::vector<std::string> m_loadedConfigs;
 
@@ -148,8 +167,11 @@ private:
 
     // Helper methods
     bool parseINI(const std::string& content);
-    std::string readFileContent(const std::string& filename) const;
-    std::string trim(const std::string& str) const;
+    void compileArchetypes();                            // After every change to m_config
+    sf::Vector2f getVector(const std::string& section, const std::string& key, const sf::Vector2f& defaultValue) const; // "x,y"
+    static void parseINIContent(const std::string& content, Sections& sections);
+    static std::string readFileContent(const std::string& filename);
+    static std::string trim(const std::string& str);
     bool stringToBool(const std::string& str) const;
 
     // Error handling
@@ -0,0 +1,56 @@
+// ================================
+// include/Utils/FileWatcher.h - Background watcher for files written in a set of directories
+// ================================
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Reports each file once it has been written and then left alone for a short
+// settle time, so an editor's truncate-write-rename sequence is one change.
+// Linux uses inotify; other platforms poll write times. Directories are not
+// watched recursively.
+class FileWatcher {
+public:
+    using ChangeCallback = std::function<void(const std::filesystem::path& path)>; // Runs on the watcher thread
+
+    FileWatcher() = default;
+    ~FileWatcher();                                      // Stops the thread
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    bool start(const std::vector<std::string>& directories, ChangeCallback callback);
+    void stop();
+    bool isRunning() const { return m_thread.joinable(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void watchLoop();
+    void markChanged(const std::filesystem::path& path);
+    void reportSettled();                                // Fire callbacks for quiet files
+
+#ifdef __linux__
+    bool openInotify();
+    void readInotifyEvents();
+
+    int m_inotifyFd = -1;
+    std::unordered_map<int, std::filesystem::path> m_watchDirectories; // Watch descriptor -> directory
+#else
+    void scanDirectories();
+
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_writeTimes;
+    Clock::time_point m_nextScan;
+#endif
+
+    std::vector<std::string> m_directories;
+    ChangeCallback m_callback;
+    std::unordered_map<std::string, Clock::time_point> m_pending; // Changed, waiting to settle
+    std::thread m_thread;
+    std::atomic<bool> m_stopping{ false };
+};
@@ -0,0 +1,34 @@
+// ================================
+// include/Utils/MappedFile.h - Read-only memory-mapped file
+// ================================
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();                                       // Unmaps if open
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool open(const std::string& filename);              // Map whole file; false on error or empty file
+    void close();                                        // Release the mapping
+
+    bool isOpen() const { return m_data != nullptr; }
+    const std::uint8_t* data() const { return m_data; }  // Valid until close()
+    size_t size() const { return m_size; }
+
+private:
+    void moveFrom(MappedFile& other);
+
+    const std::uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;                        // HANDLE
+    void* m_mappingHandle = nullptr;                     // HANDLE
+#endif
+};
@@ -8,12 +8,18 @@
 #include "Entities/Projectiles/SniperBullet.h"
 #include "States/MenuState.h"
 #include "Managers/ResourceManager.h"
+#include "Managers/AsyncAssetLoader.h"
 #include "Systems/AnimationSystem.h"
 #include "Systems/EventSystem.h"
+#include "Core/SystemScheduler.h"
+#include "Core/StartupPipeline.h"
 #include "Managers/SettingsManager.h"
 #include "States/SplashState.h"
 #include "Utils/ConfigLoader.h" 
+#include "Utils/AssetArchive.h"
+#include "Managers/HotReloadManager.h"
 #include <iostream>
+#include <algorithm>
 
 // ================================
 // Constructor - Initialize window and core systems
@@ -22,18 +28,37 @@ Game::Game()
     : m_window(sf::VideoMode(1200, 800), "Special Forces vs Robots")
     , m_stateMachine(std::make_unique<StateMachine>(this))
 {
+    m_startup = std::make_unique<StartupPipeline>();  // Starts the startup clock
     auto& config = ConfigLoader::getInstance();
 
     // Load settings and configure window
     loadInitialSettings();
     updateWindowSettings();
 
-    // Initialize core game systems
-    AudioManager::getInstance().initialize();
-    ResourceManager::getInstance().preloadGameAssets();
-    ResourceManager::getInstance().preloadMenuAssets();
-    AnimationSystem::getInstance().initialize();
-    SquadMemberFactory::getInstance().initialize();
+    // Unreferenced textures beyond the budget are evicted between states
+    if (config.loadFromFile("game.cfg")) {
+        int budgetMB = config.loadGameConfig().textureBudgetMB;
+        ResourceManager::getInstance().setMemoryBudget(static_cast<size_t>(std::max(budgetMB, 0)) * 1024 * 1024);
+    }
+
+    // Edited configs and textures in the working directory apply without a restart
+    if (config.getBool("Development", "hotReload", false)) {
+        HotReloadManager::getInstance().start(".");
+    }
+
+    // Packed assets are optional; every loader falls back to the loose files
+    if (!AssetArchive::getInstance().mount("assets.pak")) {
+        std::cout << "assets.pak not found, loading loose asset files" << std::endl;
+    }
+
+    // Audio, configs, textures and animations load while the splash screen runs
+    buildStartupPipeline();
+    m_startup->pump();                                 // Workers start before the first frame
+
+    m_eventStatsOverlay = std::make_unique<EventStatsOverlay>();
+
+    // Global systems - each ticks exactly once per frame, in phase order
+    registerSystems();
 
     // Start with splash screen using State pattern
     m_stateMachine->pushState(std::make_unique<SplashState>(this, m_stateMachine.get()));
@@ -43,21 +68,87 @@ Game::Game()
 // Destructor - Clean shutdown of systems
 // ================================
 Game::~Game() {
+    auto& scheduler = SystemScheduler::getInstance();
+    for (auto id : m_systemIds) {
+        scheduler.unregisterSystem(id);
+    }
+
+    HotReloadManager::getInstance().stop();
+    AsyncAssetLoader::getInstance().shutdown();
     AnimationSystem::getInstance().shutdown();
     AudioManager::getInstance().shutdown();
 }
 
+// ================================
+// Startup Pipeline - Independent init jobs run concurrently, then finish on the main thread
+// ================================
+void Game::buildStartupPipeline() {
+    using Affinity = StartupPipeline::Affinity;
+    static const std::vector<std::string> UNIT_CONFIGS = { "units.cfg", "robots.cfg", "projectiles.cfg", "collectibles.cfg" };
+
+    // Parse and decode off-thread; the results are handed to the main-thread tasks below
+    auto configs = std::make_shared<std::vector<ConfigLoader::Sections>>(UNIT_CONFIGS.size());
+    m_startup->addTask("ParseConfigs", Affinity::Worker, {}, [configs]() {
+        for (size_t i = 0; i < UNIT_CONFIGS.size(); ++i) {
+            if (!ConfigLoader::parseFile(UNIT_CONFIGS[i], (*configs)[i])) {
+                std::cerr << "Could not read " << UNIT_CONFIGS[i] << std::endl;
+            }
+        }
+        });
+
+    auto sounds = std::make_shared<std::vector<AudioManager::DecodedSound>>();
+    m_startup->addTask("DecodeAudio", Affinity::Worker, {}, [sounds]() {
+        *sounds = AudioManager::decodeBuiltinSounds();
+        });
+
+    // Worker threads of AsyncAssetLoader decode; its pump uploads
+    m_startup->addTask("QueueTextures", Affinity::Main, {}, []() {
+        ResourceManager::getInstance().preloadAllAssetsAsync();
+        });
+
+    m_startup->addTask("Configs", Affinity::Main, { "ParseConfigs" }, [configs]() {
+        auto& config = ConfigLoader::getInstance();
+        for (const auto& sections : *configs) {
+            config.mergeSections(sections);
+        }
+        SquadMemberFactory::getInstance().initialize();
+        });
+
+    m_startup->addTask("Audio", Affinity::Main, { "DecodeAudio" }, [sounds]() {
+        AudioManager::getInstance().initialize(std::move(*sounds));
+        });
+
+    // Clips need their sheets uploaded
+    m_startup->addTask("Animations", Affinity::Main, { "QueueTextures" }, []() {
+        AnimationSystem::getInstance().initialize();
+        }, []() { return AsyncAssetLoader::getInstance().isIdle(); });
+}
+
+bool Game::isStartupComplete() const {
+    return m_startup && m_startup->isComplete();
+}
+
+void Game::logStartupMilestone(const std::string& name) {
+    if (m_startup) {
+        m_startup->logMilestone(name);
+    }
+}
+
 // ================================
 // Main Game Loop - Core application loop
 // ================================
 void Game::run() {
-    while (m_isRunning && m_window.isOpen()) {
+    while (isRunning()) {
         applySettingsChanges();    // Handle any settings changes
         calculateDeltaTime();      // Calculate frame timing
         processEvents();           // Handle input events
         update(m_deltaTime);       // Update game logic
         render();                  // Draw everything to screen
     }
+
+    if (m_window.isOpen()) {
+        m_window.close();
+    }
 }
 
 // ================================
@@ -71,25 +162,70 @@ void Game::processEvents() {
             quit();
         }
 
-        // Pass events to current game state
+        // Passed to the current game state by the Input phase
+        m_inputEvents.push_back(event);
+    }
+}
+
+// ================================
+// System Registration - Global per-frame systems in scheduler phases
+// ================================
+void Game::registerSystems() {
+    auto& scheduler = SystemScheduler::getInstance();
+
+    // Decoded images become textures before any state looks them up this frame
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::Input, "AssetUploads", [](float) {
+        auto& loader = AsyncAssetLoader::getInstance();
+        loader.pump(loader.getUploadBudget());
+        }));
+
+    // Finishes startup tasks whose inputs are ready; does nothing once startup is done
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::Input, "Startup", [this](float) {
+        m_startup->pump();
+        }));
+
+    // Hot-reloaded configs and textures land between frames, never mid-update
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::Input, "HotReload", [](float) {
+        HotReloadManager::getInstance().applyPending();
+        }));
+
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::Input, "Input", [this](float) {
+        for (const auto& event : m_inputEvents) {
+            if (m_eventStatsOverlay && m_eventStatsOverlay->handleEvent(event)) continue;
+            if (m_stateMachine) {
+                m_stateMachine->handleEvent(event);
+            }
+        }
+        m_inputEvents.clear();
+        }));
+
+    // Current game state (menu, gameplay, pause, etc.)
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::Simulation, "StateMachine", [this](float dt) {
         if (m_stateMachine) {
-            m_stateMachine->handleEvent(event);
+            m_stateMachine->update(dt);
         }
-    }
+        }));
+
+    // Events queued during simulation and physics contacts
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::PostPhysics, "EventSystem", [](float) {
+        EventSystem::getInstance().processEvents();
+        }));
+
+    // After event handlers have triggered this frame's sounds
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::PostPhysics, "Audio", [](float dt) {
+        AudioManager::getInstance().update(dt);
+        }));
+
+    m_systemIds.push_back(scheduler.registerSystem(SystemPhase::Animation, "AnimationSystem", [](float dt) {
+        AnimationSystem::getInstance().update(dt);
+        }));
 }
 
 // ================================
 // Game Logic Update - Update all game systems
 // ================================
 void Game::update(float dt) {
-    // Update current game state (menu, gameplay, pause, etc.)
-    if (m_stateMachine) {
-        m_stateMachine->update(dt);
-    }
-
-    // Update global systems that run in all states
-    AnimationSystem::getInstance().update(dt);
-    EventSystem::getInstance().processEvents();
+    SystemScheduler::getInstance().tick(dt);
 }
 
 // ================================
@@ -102,8 +238,16 @@ void Game::render() {
     if (m_stateMachine) {
         m_stateMachine->render(m_window);
     }
+    if (m_eventStatsOverlay) {
+        m_eventStatsOverlay->draw(m_window);
+    }
 
     m_window.display();
+
+    if (!m_firstFrameShown) {
+        m_firstFrameShown = true;
+        logStartupMilestone("first frame");
+    }
 }
 
 // ================================
@@ -142,8 +286,7 @@ const sf::RenderWindow& Game::getWindow() const {
 // Application Control
 // ================================
 void Game::quit() {
-    m_isRunning = false;
-    m_window.close();
+    m_isRunning = false;           // Window is closed by run() on the main thread
 }
 
 bool Game::isRunning() const {
@@ -13,6 +13,7 @@
 #include "Managers/WaveManager.h"
 #include "UI/HUD.h"
 #include "Systems/EventSystem.h"
+#include "Core/SystemScheduler.h"
 #include "Entities/Base/Collectible.h"
 #include "Factories/CollectibleFactory.h"
 
@@ -32,6 +33,11 @@ GameManager::GameManager() {
     // Connect projectile system to physics world
     ProjectileManager::getInstance().setPhysicsWorld(m_physicsWorld.get());
 
+    // Physics steps in its own scheduler phase, after all simulation systems
+    m_physicsSystemId = SystemScheduler::getInstance().registerSystem(SystemPhase::Physics, "Physics", [this](float dt) {
+        if (!m_paused && m_physicsWorld) m_physicsWorld->step(dt);
+        });
+
     // Create all manager systems using smart pointers
     m_robotManager = std::make_unique<RobotManager>();
     m_robotManager->setGameManager(this);
@@ -47,28 +53,37 @@ GameManager::GameManager() {
     m_waveManager->setRobotManager(m_robotManager.get());
     m_robotManager->setSquadMemberManager(m_squadMemberManager.get());
 
-    // Subscribe to events using Observer pattern
-    EventSystem::getInstance().subscribe<RobotDestroyedEvent>([this](const RobotDestroyedEvent& e) {
+    // Subscribe to events using Observer pattern - tokens unsubscribe on destruction
+    auto& events = EventSystem::getInstance();
+    m_subscriptions.push_back(events.subscribe<RobotDestroyedEvent>([this](const RobotDestroyedEvent& e) {
         this->handleRobotDestroyed(e);
-        });
+        }));
 
-    EventSystem::getInstance().subscribe<BombExplosionEvent>([this](const BombExplosionEvent& e) {
+    m_subscriptions.push_back(events.subscribe<BombExplosionEvent>([this](const BombExplosionEvent& e) {
         this->handleBombExplosion(e);
-        });
+        }));
 
-    EventSystem::getInstance().subscribe<CoinDropEvent>([this](const CoinDropEvent& e) {
+    m_subscriptions.push_back(events.subscribe<CoinDropEvent>([this](const CoinDropEvent& e) {
         this->handleCoinDrop(e.position, e.robotRewardValue);
-        });
+        }));
 
-    EventSystem::getInstance().subscribe<HealthPackDropEvent>([this](const HealthPackDropEvent& e) {
+    m_subscriptions.push_back(events.subscribe<HealthPackDropEvent>([this](const HealthPackDropEvent& e) {
         this->handleHealthPackDrop(e.position);
-        });
+        }));
+
+    m_subscriptions.push_back(events.subscribe<ConfigReloadedEvent>([this](const ConfigReloadedEvent&) {
+        this->handleConfigReloaded();
+        }));
 }
 
 // ================================
 // Destructor - Clean shutdown of all systems
 // ================================
 GameManager::~GameManager() {
+    // No handlers may run against a half-destroyed manager
+    m_subscriptions.clear();
+    SystemScheduler::getInstance().unregisterSystem(m_physicsSystemId);
+
     // Stop any ongoing robot attacks before cleanup
     if (m_robotManager && m_squadMemberManager) {
         for (const auto& robot : m_robotManager->getRobots()) {
@@ -111,9 +126,6 @@ void GameManager::update(float dt) {
 
     m_elapsedTime += dt;
 
-    // Step physics simulation forward
-    if (m_physicsWorld) m_physicsWorld->step(dt);
-
     // Update all game managers
     updateManagers(dt);
 
@@ -131,11 +143,14 @@ void GameManager::update(float dt) {
 // ================================
 // Render - Draw all game elements to screen
 // ================================
-void GameManager::render(sf::RenderWindow& window) {
+void GameManager::render(sf::RenderTarget& window) {
     m_squadMemberManager->draw(window);    // Player units
     m_robotManager->draw(window);          // Enemy robots
     if (m_collectibleManager) m_collectibleManager->draw(window);  // Coins/items
     ProjectileManager::getInstance().draw(window);  // Bullets/projectiles
+}
+
+void GameManager::renderHUD(sf::RenderTarget& window) {
     m_hud->draw(window);                   // User interface
 }
 
@@ -309,6 +324,20 @@ void GameManager::handleHealthPackDrop(const sf::Vector2f& position) {
     addHealthPack(1);
 }
 
+// Hot reload: robots and squad members on the field take the new values immediately
+void GameManager::handleConfigReloaded() {
+    for (const auto& robot : m_robotManager->getRobots()) {
+        if (robot) robot->reloadConfig();
+    }
+
+    for (auto type : { GameTypes::SquadMemberType::HeavyGunner, GameTypes::SquadMemberType::Sniper,
+        GameTypes::SquadMemberType::ShieldBearer }) {
+        for (SquadMember* unit : m_squadMemberManager->getUnitsByType(type)) {
+            unit->reloadConfig();
+        }
+    }
+}
+
 // Handle bomb explosion damage to nearby robots
 void GameManager::handleBombExplosion(const BombExplosionEvent& event) {
     auto robots = m_robotManager->getRobotsInRange(event.position, event.explosionRadius);
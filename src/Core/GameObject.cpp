@@ -12,7 +12,7 @@
 // ================================
 GameObject::~GameObject() {
     // Unregister from animation system before destruction
-    AnimationSystem::getInstance().unregisterEntity(this);
+    AnimationSystem::getInstance().unregisterEntity(m_animationHandle);
     destroyPhysicsBody();
 }
 
@@ -0,0 +1,103 @@
+// ================================
+// src/Core/StartupPipeline.cpp
+// ================================
+#include "Core/StartupPipeline.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace {
+    // Runs a task, reporting how long it took; failures are logged and count as done
+    float runTimed(const std::string& name, const StartupPipeline::TaskFunction& run) {
+        sf::Clock clock;
+        try {
+            if (run) run();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Startup task " << name << " failed: " << e.what() << std::endl;
+        }
+        return clock.getElapsedTime().asSeconds() * 1000.0f;
+    }
+}
+
+StartupPipeline::~StartupPipeline() {
+    for (auto& task : m_tasks) {
+        if (task.result.valid()) {
+            task.result.wait();
+        }
+    }
+}
+
+void StartupPipeline::addTask(const std::string& name, Affinity affinity, const std::vector<std::string>& dependencies,
+    TaskFunction run, ReadyCheck ready) {
+    Task task;
+    task.name = name;
+    task.affinity = affinity;
+    task.run = std::move(run);
+    task.ready = std::move(ready);
+
+    for (const auto& dependency : dependencies) {
+        auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
+            [&dependency](const Task& added) { return added.name == dependency; });
+        if (it == m_tasks.end()) {
+            std::cerr << "Startup task " << name << " depends on unknown task " << dependency << std::endl;
+            continue;
+        }
+        task.dependencies.push_back(static_cast<size_t>(it - m_tasks.begin()));
+    }
+
+    m_tasks.push_back(std::move(task));
+}
+
+// Keeps going until nothing changes, so a chain of main tasks finishes in one frame
+void StartupPipeline::pump() {
+    if (isComplete()) return;
+
+    bool progressed = true;
+    while (progressed) {
+        progressed = false;
+
+        for (auto& task : m_tasks) {
+            if (task.state == TaskState::Running &&
+                task.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                finish(task, task.result.get());
+                progressed = true;
+            }
+            else if (task.state == TaskState::Waiting && canStart(task)) {
+                if (task.affinity == Affinity::Worker) {
+                    task.state = TaskState::Running;
+                    task.result = std::async(std::launch::async, runTimed, task.name, task.run);
+                }
+                else {
+                    finish(task, runTimed(task.name, task.run));
+                }
+                progressed = true;
+            }
+        }
+    }
+
+    if (isComplete()) {
+        logMilestone("startup tasks");
+    }
+}
+
+void StartupPipeline::logMilestone(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_milestoneMutex);
+    if (std::find(m_loggedMilestones.begin(), m_loggedMilestones.end(), name) != m_loggedMilestones.end()) return;
+    m_loggedMilestones.push_back(name);
+    std::cout << "Startup: " << name << " after " << static_cast<int>(getElapsedMs()) << " ms" << std::endl;
+}
+
+bool StartupPipeline::canStart(const Task& task) const {
+    for (size_t dependency : task.dependencies) {
+        if (m_tasks[dependency].state != TaskState::Done) return false;
+    }
+    return !task.ready || task.ready();
+}
+
+void StartupPipeline::finish(Task& task, float ms) {
+    task.state = TaskState::Done;
+    ++m_completed;
+    std::cout << "Startup task " << task.name << " took " << static_cast<int>(ms) << " ms"
+        << (task.affinity == Affinity::Worker ? " (worker)" : "") << std::endl;
+}
@@ -0,0 +1,150 @@
+// ================================
+// src/Core/SystemScheduler.cpp
+// ================================
+#include "Core/SystemScheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace {
+    const float TIMING_SMOOTHING = 0.1f;                 // Weight of the newest sample in averageMs
+
+    float elapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+SystemScheduler& SystemScheduler::getInstance() {
+    static SystemScheduler instance;
+    return instance;
+}
+
+SystemScheduler::SystemId SystemScheduler::registerSystem(SystemPhase phase, const std::string& name, TickFunction tick) {
+    if (phase >= SystemPhase::Count || !tick) {
+        return INVALID_SYSTEM;
+    }
+
+    SystemEntry entry;
+    entry.id = m_nextId++;
+    entry.tick = std::move(tick);
+    entry.timing.name = name;
+    entry.timing.phase = phase;
+    SystemId id = entry.id;
+
+    // Systems registered mid-frame start ticking next frame
+    if (m_ticking) {
+        m_pendingAdds.emplace_back(phase, std::move(entry));
+    }
+    else {
+        m_phases[static_cast<size_t>(phase)].push_back(std::move(entry));
+    }
+    return id;
+}
+
+void SystemScheduler::unregisterSystem(SystemId id) {
+    if (id == INVALID_SYSTEM) return;
+
+    for (auto& phase : m_phases) {
+        for (auto& entry : phase) {
+            if (entry.id == id) {
+                entry.removed = true;   // Erased once the current tick finishes
+                m_hasRemovals = true;
+            }
+        }
+    }
+
+    m_pendingAdds.erase(std::remove_if(m_pendingAdds.begin(), m_pendingAdds.end(),
+        [id](const auto& pending) { return pending.second.id == id; }), m_pendingAdds.end());
+
+    if (!m_ticking) {
+        applyPendingChanges();
+    }
+}
+
+void SystemScheduler::tick(float dt) {
+    if (m_ticking) {
+        std::cerr << "SystemScheduler::tick called re-entrantly - ignored" << std::endl;
+        return;
+    }
+
+    m_ticking = true;
+    auto frameStart = std::chrono::steady_clock::now();
+
+    for (auto& phase : m_phases) {
+        // Index loop: entries are only flagged, never erased, while ticking
+        for (size_t i = 0; i < phase.size(); ++i) {
+            if (phase[i].removed) continue;
+
+            auto start = std::chrono::steady_clock::now();
+            phase[i].tick(dt);
+            float ms = elapsedMs(start);
+
+            SystemTiming& timing = phase[i].timing;
+            timing.lastMs = ms;
+            timing.averageMs = timing.ticks == 0 ? ms : timing.averageMs + (ms - timing.averageMs) * TIMING_SMOOTHING;
+            timing.maxMs = std::max(timing.maxMs, ms);
+            ++timing.ticks;
+        }
+    }
+
+    m_lastFrameMs = elapsedMs(frameStart);
+    m_ticking = false;
+    applyPendingChanges();
+}
+
+void SystemScheduler::applyPendingChanges() {
+    if (m_hasRemovals) {
+        for (auto& phase : m_phases) {
+            phase.erase(std::remove_if(phase.begin(), phase.end(),
+                [](const SystemEntry& entry) { return entry.removed; }), phase.end());
+        }
+        m_hasRemovals = false;
+    }
+
+    for (auto& [phase, entry] : m_pendingAdds) {
+        m_phases[static_cast<size_t>(phase)].push_back(std::move(entry));
+    }
+    m_pendingAdds.clear();
+}
+
+std::vector<SystemScheduler::SystemTiming> SystemScheduler::getTimings() const {
+    std::vector<SystemTiming> timings;
+    for (const auto& phase : m_phases) {
+        for (const auto& entry : phase) {
+            if (!entry.removed) timings.push_back(entry.timing);
+        }
+    }
+    return timings;
+}
+
+const SystemScheduler::SystemTiming* SystemScheduler::getTiming(const std::string& name) const {
+    for (const auto& phase : m_phases) {
+        for (const auto& entry : phase) {
+            if (!entry.removed && entry.timing.name == name) return &entry.timing;
+        }
+    }
+    return nullptr;
+}
+
+void SystemScheduler::resetTimings() {
+    for (auto& phase : m_phases) {
+        for (auto& entry : phase) {
+            entry.timing.lastMs = 0.0f;
+            entry.timing.averageMs = 0.0f;
+            entry.timing.maxMs = 0.0f;
+            entry.timing.ticks = 0;
+        }
+    }
+}
+
+const char* SystemScheduler::getPhaseName(SystemPhase phase) {
+    switch (phase) {
+    case SystemPhase::Input:       return "Input";
+    case SystemPhase::Simulation:  return "Simulation";
+    case SystemPhase::Physics:     return "Physics";
+    case SystemPhase::PostPhysics: return "PostPhysics";
+    case SystemPhase::Animation:   return "Animation";
+    case SystemPhase::RenderPrep:  return "RenderPrep";
+    default:                       return "Unknown";
+    }
+}
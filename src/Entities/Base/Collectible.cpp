@@ -18,7 +18,7 @@ void Collectible::update(float dt) {
     updateSpritePosition();
 }
 
-void Collectible::draw(sf::RenderWindow& window) const {
+void Collectible::draw(sf::RenderTarget& window) const {
     if (m_collected || !isActive()) return;
 
     float timeLeft = getRemainingLifetime();
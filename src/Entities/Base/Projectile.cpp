@@ -65,7 +65,7 @@ void Projectile::update(float dt) {
     }
 }
 
-void Projectile::draw(sf::RenderWindow& window) const {
+void Projectile::draw(sf::RenderTarget& window) const {
     // Default: empty - derived classes handle their own rendering
 }
 
@@ -5,6 +5,8 @@
 #include "Physics/PhysicsUtils.h"
 #include "Systems/EventSystem.h"
 #include "Utils/ConfigLoader.h"
+#include "Graphics/HealthBarBatch.h"
+#include <algorithm>
 #include <cmath>
 #include <random>
 #include <limits>
@@ -211,44 +213,16 @@ float Robot::calculateDistanceToMember(const SquadMember* member) const {
     }
 }
 
-void Robot::draw(sf::RenderWindow& window) const {
+void Robot::draw(sf::RenderTarget&) const {
     if (!isActive()) return;
-    drawHealthBar(window);
+    queueHealthBar();
 }
 
-void Robot::drawHealthBar(sf::RenderWindow& window) const {
+void Robot::queueHealthBar() const {
     if (isDead()) return;
 
-    const float barWidth = 50.0f;
-    const float barHeight = 8.0f;
-    const float barOffsetX = 25.0f;
-    const float barOffsetY = 95.0f;
-
     float healthPercent = static_cast<float>(m_health) / static_cast<float>(m_maxHealth);
-    sf::Vector2f robotPos = getPosition();
-    sf::Vector2f barPos(robotPos.x - barOffsetX, robotPos.y - barOffsetY);
-
-    sf::RectangleShape healthBarBg(sf::Vector2f(barWidth, barHeight));
-    healthBarBg.setPosition(barPos);
-    healthBarBg.setFillColor(sf::Color::Transparent);
-    healthBarBg.setOutlineColor(sf::Color(50, 50, 50, 150));
-    healthBarBg.setOutlineThickness(1.0f);
-
-    sf::RectangleShape healthBarFg(sf::Vector2f(barWidth * healthPercent, barHeight));
-    healthBarFg.setPosition(barPos);
-
-    sf::Color healthColor;
-    if (healthPercent > 0.75f) healthColor = sf::Color::Green;
-    else if (healthPercent > 0.5f) healthColor = sf::Color(128, 255, 0);
-    else if (healthPercent > 0.25f) healthColor = sf::Color::Yellow;
-    else healthColor = sf::Color::Red;
-
-    healthBarFg.setFillColor(healthColor);
-
-    window.draw(healthBarBg);
-    if (healthPercent > 0.0f) {
-        window.draw(healthBarFg);
-    }
+    HealthBarBatch::getInstance().addBar(getPosition(), healthPercent);
 }
 
 void Robot::takeDamage(int damage) {
@@ -325,37 +299,33 @@ void Robot::stopAttackingSquadMember() {
 }
 
 void Robot::loadAttackRangeFromConfig() {
-    auto& config = ConfigLoader::getInstance();
-    std::string robotSection;
-
-    switch (m_type) {
-    case GameTypes::RobotType::Basic: robotSection = "BasicRobot"; break;
-    case GameTypes::RobotType::Fire: robotSection = "FireRobot"; break;
-    case GameTypes::RobotType::Stealth: robotSection = "StealthRobot"; break;
-    default: robotSection = "BasicRobot"; break;
+    const RobotArchetype& archetype = ConfigLoader::getInstance().getRobotArchetype(m_type);
+
+    if (archetype.health != m_health) {
+        m_health = archetype.health;
+        m_maxHealth = archetype.health;
     }
 
-    try {
-        int configHealth = config.getInt(robotSection, "health", m_health);
-        if (configHealth != m_health) {
-            m_health = configHealth;
-            m_maxHealth = configHealth;
-        }
+    m_rewardValue = archetype.reward;
+    m_attackRange = archetype.attackRange;
+    m_damage = archetype.damage;
+    m_attackDamage = m_damage;
+}
 
-        float configSpeed = config.getFloat(robotSection, "speed", m_originalSpeed);
-        if (configSpeed != m_originalSpeed) {
-            float currentVariation = m_originalSpeed / configSpeed;
-            m_originalSpeed = configSpeed * currentVariation;
-        }
+// Live robots keep their health fraction so a balance tweak never kills or revives them
+void Robot::reloadConfig() {
+    if (isDead()) return;
 
-        m_rewardValue = config.getInt(robotSection, "reward", m_rewardValue);
-        m_attackRange = config.getFloat(robotSection, "attackRange", 100.0f);
-        m_damage = config.getInt(robotSection, "damage", m_damage);
-        m_attackDamage = m_damage;
-    }
-    catch (const std::exception&) {
-        // Use constructor defaults on error
-    }
+    const RobotArchetype& archetype = ConfigLoader::getInstance().getRobotArchetype(m_type);
+    float healthFraction = m_maxHealth > 0 ? static_cast<float>(m_health) / m_maxHealth : 1.0f;
+
+    m_maxHealth = archetype.health;
+    m_health = std::max(1, static_cast<int>(std::lround(m_maxHealth * healthFraction)));
+    m_originalSpeed = archetype.speed;
+    m_rewardValue = archetype.reward;
+    m_attackRange = archetype.attackRange;
+    m_damage = archetype.damage;
+    m_attackDamage = archetype.meleeAttackDamage;
 }
 
 // Getters and simple methods
@@ -2,6 +2,7 @@
 #include "Entities/Base/Robot.h"
 #include "Core/Constants.h"
 #include "Utils/ConfigLoader.h"
+#include "Graphics/HealthBarBatch.h"
 #include <cmath>
 #include <algorithm>
 #include <limits>
@@ -39,51 +40,15 @@ void SquadMember::update(float dt) {
     syncSpriteFromPhysics();
 }
 
-void SquadMember::draw(sf::RenderWindow& window) const {
-    drawHealthBar(window);
+void SquadMember::draw(sf::RenderTarget&) const {
+    queueHealthBar();
 }
 
-void SquadMember::drawHealthBar(sf::RenderWindow& window) const {
+void SquadMember::queueHealthBar() const {
     if (m_isDying || isDestroyed()) return;
 
-    const float barWidth = 50.0f;
-    const float barHeight = 8.0f;
-    const float barOffsetX = 25.0f;
-    const float barOffsetY = 95.0f;
-
     float healthPercent = static_cast<float>(m_health) / static_cast<float>(m_maxHealth);
-    sf::Vector2f unitPos = getPosition();
-    sf::Vector2f barPos(unitPos.x - barOffsetX, unitPos.y - barOffsetY);
-
-    sf::RectangleShape healthBarBg(sf::Vector2f(barWidth, barHeight));
-    healthBarBg.setPosition(barPos);
-    healthBarBg.setFillColor(sf::Color::Transparent);
-    healthBarBg.setOutlineColor(sf::Color(50, 50, 50, 150));
-    healthBarBg.setOutlineThickness(1.0f);
-
-    sf::RectangleShape healthBarFg(sf::Vector2f(barWidth * healthPercent, barHeight));
-    healthBarFg.setPosition(barPos);
-
-    sf::Color healthColor;
-    if (healthPercent > 0.75f) {
-        healthColor = sf::Color::Green;
-    }
-    else if (healthPercent > 0.5f) {
-        healthColor = sf::Color(128, 255, 0);
-    }
-    else if (healthPercent > 0.25f) {
-        healthColor = sf::Color::Yellow;
-    }
-    else {
-        healthColor = sf::Color::Red;
-    }
-
-    healthBarFg.setFillColor(healthColor);
-
-    window.draw(healthBarBg);
-    if (healthPercent > 0.0f) {
-        window.draw(healthBarFg);
-    }
+    HealthBarBatch::getInstance().addBar(getPosition(), healthPercent);
 }
 
 GameTypes::SquadMemberType SquadMember::getType() const { return m_type; }
@@ -237,19 +202,29 @@ bool SquadMember::canBeHealed() const {
     return !isDestroyed() && !m_isDying && m_health < m_maxHealth;
 }
 
-void SquadMember::initializeConfigFromName(const std::string& configName, float defaultAttackSpeed) {
-    auto& config = ConfigLoader::getInstance();
+// Live units keep their health fraction; the attack timer keeps running
+void SquadMember::reloadConfig() {
+    if (isDestroyed() || m_isDying) return;
 
-    try {
-        m_health = config.getInt(configName, "health", 100);
-        m_maxHealth = m_health;
-        m_range = config.getFloat(configName, "range", 200.0f);
-        m_baseCost = config.getInt(configName, "cost", 40);
-        m_attackCooldown = config.getFloat(configName, "attackSpeed", defaultAttackSpeed);
+    const UnitArchetype& archetype = ConfigLoader::getInstance().getUnitArchetype(m_type);
+    float healthFraction = m_maxHealth > 0 ? static_cast<float>(m_health) / m_maxHealth : 1.0f;
 
-        m_attackTimer.setDuration(m_attackCooldown);
-    }
-    catch (const std::exception& e) {
-        // Keep existing defaults set in constructor
-    }
+    m_maxHealth = archetype.health;
+    m_health = std::max(1, static_cast<int>(std::lround(m_maxHealth * healthFraction)));
+    m_range = archetype.range;
+    m_baseCost = archetype.cost;
+    m_attackCooldown = archetype.attackSpeed;
+    m_attackTimer.setDuration(m_attackCooldown);
+}
+
+void SquadMember::initializeConfigFromArchetype() {
+    const UnitArchetype& archetype = ConfigLoader::getInstance().getUnitArchetype(m_type);
+
+    m_health = archetype.health;
+    m_maxHealth = m_health;
+    m_range = archetype.range;
+    m_baseCost = archetype.cost;
+    m_attackCooldown = archetype.attackSpeed;
+
+    m_attackTimer.setDuration(m_attackCooldown);
 }
\ No newline at end of file
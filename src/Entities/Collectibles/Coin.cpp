@@ -6,15 +6,13 @@ Coin::Coin(int robotRewardValue)
     : Collectible(GameTypes::CollectibleType::Coin, robotRewardValue, Coin::VISUAL_DURATION)
 {
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.registerCollectible(this);
-    AudioManager::getInstance().playSound("coin_added", AudioManager::AudioCategory::SFX, 0.5f);
-    if (animSystem.hasAnimation("CoinSpin")) {
-        animSystem.playAnimation(this, "CoinSpin");
-    }
+    m_animationHandle = animSystem.registerCollectible(this);
+    AudioManager::getInstance().playSound(SoundId::CoinAdded, AudioManager::AudioCategory::SFX, 0.5f);
+    animSystem.playAnimation(m_animationHandle, animSystem.getAnimationId("CoinSpin"));
 }
 
 void Coin::update(float dt) {
-    AnimationSystem::getInstance().updateEntityPosition(this, getPosition());
+    AnimationSystem::getInstance().updateEntityPosition(m_animationHandle, getPosition());
 
     if (m_autoCollected) {
         m_visualTimer += dt;
@@ -27,7 +25,7 @@ void Coin::update(float dt) {
     }
 }
 
-void Coin::draw(sf::RenderWindow& window) const {
+void Coin::draw(sf::RenderTarget& window) const {
     if (!isActive()) return;
 
     if (m_autoCollected) {
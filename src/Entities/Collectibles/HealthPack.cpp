@@ -8,20 +8,17 @@ HealthPack::HealthPack(int healAmount)
     m_healAmount(healAmount)
 {
     auto& animSystem = AnimationSystem::getInstance();
-    AudioManager::getInstance().playSound("health_kit_added");
-    animSystem.registerCollectible(this);
-
-    if (animSystem.hasAnimation("HealthBag")) {
-        animSystem.playAnimation(this, "HealthBag");
-    }
+    AudioManager::getInstance().playSound(SoundId::HealthKitAdded);
+    m_animationHandle = animSystem.registerCollectible(this);
+    animSystem.playAnimation(m_animationHandle, animSystem.getAnimationId("HealthBag"));
 }
 
 void HealthPack::update(float dt) {
-    AnimationSystem::getInstance().updateEntityPosition(this, getPosition());
+    AnimationSystem::getInstance().updateEntityPosition(m_animationHandle, getPosition());
     Collectible::update(dt);
 }
 
-void HealthPack::draw(sf::RenderWindow& window) const {
+void HealthPack::draw(sf::RenderTarget& window) const {
     if (!isActive() || isCollected()) return;
 }
 
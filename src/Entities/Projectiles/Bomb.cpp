@@ -8,7 +8,8 @@
 Bomb::Bomb(const sf::Vector2f& pos)
     : m_position(pos), m_animComponent(std::make_unique<AnimationComponent>(nullptr))
 {
-    m_sprite.setTexture(ResourceManager::getInstance().getTexture("bomb.png"));
+    m_animComponent->setRenderLayer(RenderLayer::Effects);
+    m_sprite.setTexture(ResourceManager::getInstance().getTexture(TextureId::Bomb));
     m_sprite.setOrigin(m_sprite.getTexture()->getSize().x / 2.f, m_sprite.getTexture()->getSize().y / 2.f);
     m_sprite.setPosition(pos);
 }
@@ -28,12 +29,12 @@ void Bomb::update(float dt) {
     }
 }
 
-void Bomb::render(sf::RenderWindow& window) const {
+void Bomb::render(sf::RenderTarget&) const {
     if (!m_exploded) {
-        window.draw(m_sprite);
+        RenderQueue::getInstance().submit(RenderLayer::Ground, m_sprite);
     }
     else if (m_animComponent) {
-        m_animComponent->draw(window);
+        m_animComponent->queueDraw();
     }
 }
 
@@ -42,7 +43,7 @@ bool Bomb::isDone() const {
 }
 
 void Bomb::explode() {
-    AudioManager::getInstance().playSound("explosion", AudioManager::AudioCategory::UI);
+    AudioManager::getInstance().playSound(SoundId::Explosion, AudioManager::AudioCategory::UI);
     if (m_exploded) return;
 
     m_exploded = true;
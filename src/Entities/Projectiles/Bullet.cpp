@@ -1,6 +1,7 @@
 ﻿#include "Entities/Projectiles/Bullet.h"
 #include "Entities/Base/Robot.h"
 #include "Entities/Base/SquadMember.h"
+#include "Graphics/RenderQueue.h"
 #include "Managers/ResourceManager.h"
 #include "Physics/PhysicsUtils.h"
 #include "Utils/ConfigLoader.h"
@@ -19,15 +20,12 @@ Bullet::Bullet(int damage, const sf::Vector2f& targetPos, SquadMember* source)
 }
 
 void Bullet::setupBulletProperties() {
-    // Load configuration once
-    auto& config = ConfigLoader::getInstance();
-    float scale = config.getFloat("SquadBullet", "scale", 0.03f);
-    std::string textureFile = config.getString("SquadBullet", "texture", "bullet.png");
-    m_maxRange = config.getFloat("SquadBullet", "maxRange", 300.0f);
+    const ProjectileArchetype& archetype = ConfigLoader::getInstance().getProjectileArchetype(getType());
+    float scale = archetype.scale;
+    m_maxRange = archetype.maxRange;
 
     // Setup sprite
-    auto& resourceManager = ResourceManager::getInstance();
-    m_sprite.setTexture(resourceManager.getTexture(textureFile));
+    m_sprite.setTexture(ResourceManager::getInstance().getTexture(archetype.texture));
 
     sf::FloatRect bounds = m_sprite.getLocalBounds();
     m_sprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
@@ -44,9 +42,9 @@ void Bullet::update(float dt) {
     m_sprite.setPosition(getPosition());
 }
 
-void Bullet::draw(sf::RenderWindow& window) const {
+void Bullet::draw(sf::RenderTarget&) const {
     if (isActive() && !m_shouldRemove) {
-        window.draw(m_sprite);
+        RenderQueue::getInstance().submit(RenderLayer::Projectiles, m_sprite);
     }
 }
 
@@ -55,8 +53,7 @@ void Bullet::createPhysicsBody(b2World* world) {
 
     if (m_physicsBody) {
         // Set velocity from config
-        auto& config = ConfigLoader::getInstance();
-        float speed = config.getFloat("SquadBullet", "speed", 400.0f);
+        float speed = ConfigLoader::getInstance().getProjectileArchetype(getType()).speed;
         b2Vec2 velocity = PhysicsUtils::sfmlToBox2D(sf::Vector2f(speed, 0.0f));
         m_physicsBody->SetLinearVelocity(velocity);
     }
@@ -1,6 +1,7 @@
 ﻿#include "Entities/Projectiles/RobotBullet.h"
 #include "Entities/Base/Robot.h"
 #include "Entities/Base/SquadMember.h"
+#include "Graphics/RenderQueue.h"
 #include "Managers/ResourceManager.h"
 #include "Managers/AudioManager.h"
 #include "Physics/PhysicsUtils.h"
@@ -21,25 +22,12 @@ RobotBullet::RobotBullet(int damage, const sf::Vector2f& targetPos, SquadMember*
 }
 
 void RobotBullet::setupRobotBulletProperties() {
-    auto& config = ConfigLoader::getInstance();
-
-    m_bulletSpeed = config.getFloat("RobotBullet", "speed", -400.0f);
-    m_bulletScale = config.getFloat("RobotBullet", "scale", 0.04f);
-    m_maxRange = config.getFloat("RobotBullet", "maxRange", 800.0f);
-
-    // Parse spawn offset
-    std::string offsetStr = config.getString("RobotBullet", "spawnOffset", "-30,-50");
-    m_spawnOffset = sf::Vector2f(-30.0f, -50.0f);
-    size_t comma = offsetStr.find(',');
-    if (comma != std::string::npos) {
-        try {
-            m_spawnOffset.x = std::stof(offsetStr.substr(0, comma));
-            m_spawnOffset.y = std::stof(offsetStr.substr(comma + 1));
-        }
-        catch (const std::exception&) {
-            // Use default
-        }
-    }
+    const ProjectileArchetype& archetype = ConfigLoader::getInstance().getProjectileArchetype(getType());
+
+    m_bulletSpeed = archetype.speed;
+    m_bulletScale = archetype.scale;
+    m_maxRange = archetype.maxRange;
+    m_spawnOffset = archetype.spawnOffset;
 
     // Load bullet color
     m_bulletColor = sf::Color(255, 0, 0); // Default red
@@ -50,12 +38,12 @@ void RobotBullet::setupRobotBulletProperties() {
 }
 
 void RobotBullet::loadRobotBulletTexture() {
-    auto& resourceManager = ResourceManager::getInstance();
-    std::string textureFile = ConfigLoader::getInstance().getString("RobotBullet", "texture", "robot_bullet.png");
-      AudioManager::getInstance().playSound("robot_bullet", AudioManager::AudioCategory::SFX, 0.3f);
+    TextureId texture = ConfigLoader::getInstance().getProjectileArchetype(getType()).texture;
+      AudioManager::getInstance().playSound(SoundId::RobotBullet, AudioManager::AudioCategory::SFX, 0.3f);
 
-    if (resourceManager.hasTexture(textureFile)) {
-        m_sprite.setTexture(resourceManager.getTexture(textureFile));
+    const sf::Texture& bulletTexture = ResourceManager::getInstance().getTexture(texture);
+    if (bulletTexture.getSize().x > 0) {
+        m_sprite.setTexture(bulletTexture);
         sf::FloatRect bounds = m_sprite.getLocalBounds();
         m_sprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
         m_sprite.setScale(m_bulletScale, m_bulletScale);
@@ -109,18 +97,19 @@ void RobotBullet::update(float dt) {
     }
 }
 
-void RobotBullet::draw(sf::RenderWindow& window) const {
+void RobotBullet::draw(sf::RenderTarget&) const {
     if (m_hasHit || m_shouldRemove) return;
 
     sf::Vector2f currentPos = getPosition();
+    auto& queue = RenderQueue::getInstance();
 
     if (m_sprite.getTexture()) {
         const_cast<sf::Sprite&>(m_sprite).setPosition(currentPos);
-        window.draw(m_sprite);
+        queue.submit(RenderLayer::Projectiles, m_sprite);
     }
     else {
         const_cast<sf::RectangleShape&>(m_bulletShape).setPosition(currentPos);
-        window.draw(m_bulletShape);
+        queue.submitRect(RenderLayer::Projectiles, m_bulletShape.getGlobalBounds(), m_bulletShape.getFillColor());
     }
 }
 
@@ -1,6 +1,7 @@
 ﻿#include "Entities/Projectiles/SniperBullet.h"
 #include "Entities/Base/Robot.h"
 #include "Entities/Base/SquadMember.h"
+#include "Graphics/RenderQueue.h"
 #include "Managers/ResourceManager.h"
 #include "Physics/PhysicsUtils.h"
 #include "Utils/ConfigLoader.h"
@@ -18,15 +19,12 @@ SniperBullet::SniperBullet(int damage, const sf::Vector2f& targetPos, SquadMembe
 }
 
 void SniperBullet::setupSniperBulletProperties() {
-    // Load configuration once
-    auto& config = ConfigLoader::getInstance();
-    float scale = config.getFloat("SniperBullet", "scale", 0.06f);
-    std::string textureFile = config.getString("SniperBullet", "texture", "SniperBullet.png");
-    m_maxRange = config.getFloat("SniperBullet", "maxRange", 350.0f);
+    const ProjectileArchetype& archetype = ConfigLoader::getInstance().getProjectileArchetype(getType());
+    float scale = archetype.scale;
+    m_maxRange = archetype.maxRange;
 
     // Setup sprite
-    auto& resourceManager = ResourceManager::getInstance();
-    m_sprite.setTexture(resourceManager.getTexture(textureFile));
+    m_sprite.setTexture(ResourceManager::getInstance().getTexture(archetype.texture));
 
     sf::FloatRect bounds = m_sprite.getLocalBounds();
     m_sprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
@@ -42,9 +40,9 @@ void SniperBullet::update(float dt) {
     m_sprite.setPosition(getPosition());
 }
 
-void SniperBullet::draw(sf::RenderWindow& window) const {
+void SniperBullet::draw(sf::RenderTarget&) const {
     if (isActive() && !m_shouldRemove) {
-        window.draw(m_sprite);
+        RenderQueue::getInstance().submit(RenderLayer::Projectiles, m_sprite);
     }
 }
 
@@ -52,8 +50,7 @@ void SniperBullet::createPhysicsBody(b2World* world) {
     createStandardPhysicsBody(world, true, 2.0f, 0.1f, 0.0f);
 
     if (m_physicsBody) {
-        auto& config = ConfigLoader::getInstance();
-        float speed = config.getFloat("SniperBullet", "speed", 600.0f);
+        float speed = ConfigLoader::getInstance().getProjectileArchetype(getType()).speed;
         b2Vec2 velocity = PhysicsUtils::sfmlToBox2D(sf::Vector2f(speed, 0.0f));
         m_physicsBody->SetLinearVelocity(velocity);
     }
@@ -16,47 +16,43 @@ BasicRobot::BasicRobot()
 }
 
 void BasicRobot::setupFromConfig() {
-    // Load config once - Base Robot class handles common config loading
-    auto& config = ConfigLoader::getInstance();
-
-    try {
-        m_health = config.getInt("BasicRobot", "health", 100);
-        m_maxHealth = m_health;
-        m_damage = config.getInt("BasicRobot", "damage", 25);
-        m_rewardValue = config.getInt("BasicRobot", "reward", 30);
-        m_originalSpeed = config.getFloat("BasicRobot", "speed", 50.0f);
-        m_attackRange = config.getFloat("BasicRobot", "attackRange", 100.0f);
-        m_attackDamage = m_damage;
-    }
-    catch (const std::exception&) {
-        // Use constructor defaults
-    }
+    // Base Robot class handles common config loading
+    const RobotArchetype& archetype = ConfigLoader::getInstance().getRobotArchetype(GameTypes::RobotType::Basic);
+
+    m_health = archetype.health;
+    m_maxHealth = m_health;
+    m_damage = archetype.damage;
+    m_rewardValue = archetype.reward;
+    m_originalSpeed = archetype.speed;
+    m_attackRange = archetype.attackRange;
+    m_attackDamage = m_damage;
 }
 
 void BasicRobot::initializeAnimations() {
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.registerRobot(this);
+    m_animationHandle = animSystem.registerRobot(this);
 
-    if (animSystem.hasAnimation("BasicRobotWalk")) {
-        animSystem.playAnimation(this, "BasicRobotWalk");
-    }
+    m_walkClip = animSystem.getAnimationId("BasicRobotWalk");
+    m_hitClip = animSystem.getAnimationId("BasicRobotHit");
+    m_deadClip = animSystem.getAnimationId("BasicRobotDead");
+
+    animSystem.playAnimation(m_animationHandle, m_walkClip);
 }
 
 void BasicRobot::updateAnimation(float dt) {
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.updateEntityPosition(this, getPosition());
+    animSystem.updateEntityPosition(m_animationHandle, getPosition());
 
     if (isMovementEnabled() && !isDead()) {
         setFacingDirection(true);
     }
 
     if (isDead() && !m_deathAnimationStarted) {
-        AudioManager::getInstance().playSound("rock_robot_die", AudioManager::AudioCategory::SFX,  0.3f);
+        AudioManager::getInstance().playSound(SoundId::RockRobotDie, AudioManager::AudioCategory::SFX,  0.3f);
         m_deathAnimationStarted = true;
 
-        if (animSystem.hasAnimation("BasicRobotDead")) {
-            animSystem.playAnimation(this, "BasicRobotDead");
-            animSystem.setAnimationCompleteCallback(this, [this]() {
+        if (animSystem.playAnimation(m_animationHandle, m_deadClip)) {
+            animSystem.setAnimationCompleteCallback(m_animationHandle, [this]() {
                 setActive(false);
                 });
         }
@@ -112,13 +108,10 @@ void BasicRobot::switchToAttackAnimation() {
 
     auto& animSystem = AnimationSystem::getInstance();
     setMovementEnabled(false);
-    AudioManager::getInstance().playSound("rock_robot_hit");
-    if (animSystem.hasAnimation("BasicRobotHit")) {
-        animSystem.playAnimation(this, "BasicRobotHit");
-    }
-    else {
-        if (animSystem.isEntityPlayingAnimation(this, "BasicRobotWalk")) {
-            animSystem.pauseEntityAnimation(this);
+    AudioManager::getInstance().playSound(SoundId::RockRobotHit);
+    if (!animSystem.playAnimation(m_animationHandle, m_hitClip)) {
+        if (animSystem.isEntityPlayingAnimation(m_animationHandle, m_walkClip)) {
+            animSystem.pauseEntityAnimation(m_animationHandle);
         }
     }
 }
@@ -129,10 +122,10 @@ void BasicRobot::switchToWalkingAnimation() {
     auto& animSystem = AnimationSystem::getInstance();
     setMovementEnabled(true);
 
-    if (animSystem.isEntityAnimationPaused(this)) {
-        animSystem.resumeEntityAnimation(this);
+    if (animSystem.isEntityAnimationPaused(m_animationHandle)) {
+        animSystem.resumeEntityAnimation(m_animationHandle);
     }
-    else if (animSystem.hasAnimation("BasicRobotWalk")) {
-        animSystem.playAnimation(this, "BasicRobotWalk");
+    else {
+        animSystem.playAnimation(m_animationHandle, m_walkClip);
     }
 }
\ No newline at end of file
@@ -24,31 +24,44 @@ FireRobot::FireRobot()
 
 void FireRobot::setupFromConfig() {
     auto& config = ConfigLoader::getInstance();
+    const RobotArchetype& archetype = config.getRobotArchetype(GameTypes::RobotType::Fire);
+
+    m_health = archetype.health;
+    m_maxHealth = m_health;
+    m_rewardValue = archetype.reward;
+    m_originalSpeed = archetype.speed;
+    m_attackRange = archetype.attackRange;
+    m_bulletCooldown = archetype.bulletCooldown;
+    m_bulletDamage = config.getProjectileArchetype(GameTypes::ProjectileType::RobotBullet).damage;
+
+    // Ranged only; the bullets carry the damage
+    m_damage = 0;
+    m_attackDamage = 0;
+}
 
-    try {
-        m_health = config.getInt("FireRobot", "health", 80);
-        m_maxHealth = m_health;
-        m_rewardValue = config.getInt("FireRobot", "reward", 50);
-        m_originalSpeed = config.getFloat("FireRobot", "speed", 40.0f);
-        m_attackRange = config.getFloat("FireRobot", "attackRange", 200.0f);
-        m_bulletCooldown = config.getFloat("FireRobot", "bulletCooldown", 2.0f);
-        m_bulletDamage = config.getInt("RobotBullet", "damage", 35);
-
-        m_damage = 0;
-        m_attackDamage = 0;
-    }
-    catch (const std::exception&) {
-        // Use defaults
-        m_bulletCooldown = 2.0f;
-        m_attackRange = 200.0f;
-        m_bulletDamage = 35;
-        m_rewardValue = 50;
-    }
+// The running cooldown keeps its elapsed time, so a shorter cooldown can fire at once
+void FireRobot::reloadConfig() {
+    if (isDead()) return;
+    Robot::reloadConfig();
+
+    auto& config = ConfigLoader::getInstance();
+    m_bulletCooldown = config.getRobotArchetype(GameTypes::RobotType::Fire).bulletCooldown;
+    m_bulletTimer.setDuration(m_bulletCooldown);
+    m_bulletDamage = config.getProjectileArchetype(GameTypes::ProjectileType::RobotBullet).damage;
+
+    // Ranged only; the bullets carry the damage
+    m_damage = 0;
+    m_attackDamage = 0;
 }
 
 void FireRobot::initializeAnimations() {
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.registerRobot(this);
+    m_animationHandle = animSystem.registerRobot(this);
+
+    m_walkClip = animSystem.getAnimationId("FireRobotWalk");
+    m_staticClip = animSystem.getAnimationId("FireRobotStatic");
+    m_deathClip = animSystem.getAnimationId("FireRobotDeath");
+
     switchToWalkingAnimation();
 }
 
@@ -196,27 +209,14 @@ bool FireRobot::canFireBullet() const {
 }
 
 sf::Vector2f FireRobot::getBulletSpawnPosition() const {
-    sf::Vector2f robotPos = getPosition();
-    auto& config = ConfigLoader::getInstance();
-    std::string offsetStr = config.getString("RobotBullet", "spawnOffset", "-30,-50");
-    sf::Vector2f spawnOffset(-30.0f, -50.0f);
-
-    size_t comma = offsetStr.find(',');
-    if (comma != std::string::npos) {
-        try {
-            spawnOffset.x = std::stof(offsetStr.substr(0, comma));
-            spawnOffset.y = std::stof(offsetStr.substr(comma + 1));
-        }
-        catch (...) {}
-    }
-
-    return robotPos + spawnOffset;
+    const ProjectileArchetype& bullet = ConfigLoader::getInstance().getProjectileArchetype(GameTypes::ProjectileType::RobotBullet);
+    return getPosition() + bullet.spawnOffset;
 }
 
 void FireRobot::updateAnimation(float dt) {
     Robot::updateAnimation(dt);
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.updateEntityPosition(this, getPosition());
+    animSystem.updateEntityPosition(m_animationHandle, getPosition());
 
     if (!isDead()) {
         setFacingDirection(true);
@@ -238,27 +238,27 @@ void FireRobot::switchToWalkingAnimation() {
     setMovementEnabled(true);
     m_isShooting = false;
 
-    if (animSystem.isEntityAnimationPaused(this)) {
-        animSystem.resumeEntityAnimation(this);
+    if (animSystem.isEntityAnimationPaused(m_animationHandle)) {
+        animSystem.resumeEntityAnimation(m_animationHandle);
     }
-    else if (animSystem.hasAnimation("FireRobotWalk")) {
-        animSystem.playAnimation(this, "FireRobotWalk");
+    else {
+        animSystem.playAnimation(m_animationHandle, m_walkClip);
     }
 }
 
 void FireRobot::switchToAttackAnimation() {
     if (isDead()) return;
-    AudioManager::getInstance().playSound("robot_bullet");
+    AudioManager::getInstance().playSound(SoundId::RobotBullet);
     auto& animSystem = AnimationSystem::getInstance();
     m_currentAnimationState = "attacking";
     setMovementEnabled(false);
     m_isShooting = true;
 
-    if (animSystem.isEntityPlayingAnimation(this, "FireRobotWalk")) {
-        animSystem.pauseEntityAnimation(this);
+    if (animSystem.isEntityPlayingAnimation(m_animationHandle, m_walkClip)) {
+        animSystem.pauseEntityAnimation(m_animationHandle);
     }
-    else if (animSystem.hasAnimation("FireRobotStatic")) {
-        animSystem.playAnimation(this, "FireRobotStatic");
+    else {
+        animSystem.playAnimation(m_animationHandle, m_staticClip);
     }
 }
 
@@ -270,17 +270,16 @@ void FireRobot::switchToDeathAnimation() {
     m_isShooting = false;
     m_shootingTarget = nullptr;
     m_hasTargetInRange = false;
-   // AudioManager::getInstance().playSound("stealth_robot_die" ,AudioManager::AudioCategory::SFX, 0.3f);
+   // AudioManager::getInstance().playSound(SoundId::StealthRobotDie ,AudioManager::AudioCategory::SFX, 0.3f);
     auto& animSystem = AnimationSystem::getInstance();
     m_currentAnimationState = "death";
 
-    if (animSystem.isEntityAnimationPaused(this)) {
-        animSystem.resumeEntityAnimation(this);
+    if (animSystem.isEntityAnimationPaused(m_animationHandle)) {
+        animSystem.resumeEntityAnimation(m_animationHandle);
     }
 
-    if (animSystem.hasAnimation("FireRobotDeath")) {
-        animSystem.playAnimation(this, "FireRobotDeath");
-        animSystem.setAnimationCompleteCallback(this, [this]() {
+    if (animSystem.playAnimation(m_animationHandle, m_deathClip)) {
+        animSystem.setAnimationCompleteCallback(m_animationHandle, [this]() {
             setActive(false);
             });
     }
@@ -18,26 +18,26 @@ StealthRobot::StealthRobot()
 }
 
 void StealthRobot::setupFromConfig() {
-    auto& config = ConfigLoader::getInstance();
+    const RobotArchetype& archetype = ConfigLoader::getInstance().getRobotArchetype(GameTypes::RobotType::Stealth);
 
-    try {
-        m_health = config.getInt("StealthRobot", "health", 70);
-        m_maxHealth = m_health;
-        m_damage = config.getInt("StealthRobot", "damage", 40);
-        m_rewardValue = config.getInt("StealthRobot", "reward", 35);
-        m_originalSpeed = config.getFloat("StealthRobot", "speed", 60.0f);
-        m_attackRange = config.getFloat("StealthRobot", "attackRange", 100.0f);
+    m_health = archetype.health;
+    m_maxHealth = m_health;
+    m_damage = archetype.damage;
+    m_rewardValue = archetype.reward;
+    m_originalSpeed = archetype.speed;
+    m_attackRange = archetype.attackRange;
 
-        m_attackDamage = m_damage;
-    }
-    catch (const std::exception& e) {
-        // Constructor defaults will be used
-    }
+    m_attackDamage = m_damage;
 }
 
 void StealthRobot::initializeAnimations() {
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.registerRobot(this);
+    m_animationHandle = animSystem.registerRobot(this);
+
+    m_walkClip = animSystem.getAnimationId("StealthRobotWalk");
+    m_hitClip = animSystem.getAnimationId("StealthRobotHit");
+    m_deadClip = animSystem.getAnimationId("StealthRobotDead");
+
     switchToWalkingAnimation();
 }
 
@@ -107,7 +107,7 @@ void StealthRobot::updateAnimation(float dt) {
     Robot::updateAnimation(dt);
 
     auto& animSystem = AnimationSystem::getInstance();
-    animSystem.updateEntityPosition(this, getPosition());
+    animSystem.updateEntityPosition(m_animationHandle, getPosition());
 
     if (!isDead()) {
         setFacingDirection(true);
@@ -126,27 +126,25 @@ void StealthRobot::switchToWalkingAnimation() {
     setMovementEnabled(true);
     m_isAttacking = false;
 
-    if (animSystem.isEntityAnimationPaused(this)) {
-        animSystem.resumeEntityAnimation(this);
+    if (animSystem.isEntityAnimationPaused(m_animationHandle)) {
+        animSystem.resumeEntityAnimation(m_animationHandle);
     }
-    else if (animSystem.hasAnimation("StealthRobotWalk")) {
-        animSystem.playAnimation(this, "StealthRobotWalk");
+    else {
+        animSystem.playAnimation(m_animationHandle, m_walkClip);
     }
 }
 
 void StealthRobot::switchToAttackAnimation() {
     if (isDead()) return;
-    AudioManager::getInstance().playSound("stealth_robot_hit");
+    AudioManager::getInstance().playSound(SoundId::StealthRobotHit);
     auto& animSystem = AnimationSystem::getInstance();
     m_currentAnimationState = "attacking";
     setMovementEnabled(false);
     m_isAttacking = true;
 
-    if (animSystem.hasAnimation("StealthRobotHit")) {
-        animSystem.playAnimation(this, "StealthRobotHit");
-    }
-    else if (animSystem.isEntityPlayingAnimation(this, "StealthRobotWalk")) {
-        animSystem.pauseEntityAnimation(this);
+    if (!animSystem.playAnimation(m_animationHandle, m_hitClip) &&
+        animSystem.isEntityPlayingAnimation(m_animationHandle, m_walkClip)) {
+        animSystem.pauseEntityAnimation(m_animationHandle);
     }
 }
 
@@ -156,13 +154,12 @@ void StealthRobot::switchToDeathAnimation() {
     m_deathAnimationStarted = true;
     setMovementEnabled(false);
     m_isAttacking = false;
-    AudioManager::getInstance().playSound("stealth_robot_die", AudioManager::AudioCategory::SFX, 0.2f);
+    AudioManager::getInstance().playSound(SoundId::StealthRobotDie, AudioManager::AudioCategory::SFX, 0.2f);
     auto& animSystem = AnimationSystem::getInstance();
     m_currentAnimationState = "death";
 
-    if (animSystem.hasAnimation("StealthRobotDead")) {
-        animSystem.playAnimation(this, "StealthRobotDead");
-        animSystem.setAnimationCompleteCallback(this, [this]() {
+    if (animSystem.playAnimation(m_animationHandle, m_deadClip)) {
+        animSystem.setAnimationCompleteCallback(m_animationHandle, [this]() {
             setActive(false);
             });
     }
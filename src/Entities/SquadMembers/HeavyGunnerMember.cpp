@@ -1,6 +1,5 @@
 ﻿#include "Entities/SquadMembers/HeavyGunnerMember.h"
 #include "Entities/Base/Robot.h"
-#include "Graphics/AnimationComponent.h"
 #include "Systems/AnimationSystem.h"
 #include "Managers/ProjectileManager.h"
 #include "Managers/AudioManager.h"
@@ -9,7 +8,6 @@
 
 HeavyGunnerMember::HeavyGunnerMember()
     : SquadMember(GameTypes::SquadMemberType::HeavyGunner, 40, 200.0f, 25)
-    , m_animationComponent(this)
     , m_attackDelay(1.5f)
     , m_canFire(true)
     , m_currentTarget(nullptr)
@@ -19,28 +17,30 @@ HeavyGunnerMember::HeavyGunnerMember()
     initializeFromConfig();
     initializeAnimation();
     setupAnimationCallbacks();
-    AnimationSystem::getInstance().registerSquadMember(this);
     m_attackTimer.setDuration(m_attackDelay);
     m_attackTimer.restart();
 }
 
 void HeavyGunnerMember::initializeFromConfig() {
-    initializeConfigFromName("HeavyGunner", 1.5f);
+    initializeConfigFromArchetype();
 
-    auto& config = ConfigLoader::getInstance();
-    m_damage = config.getInt("SquadBullet", "damage", 25);
+    m_damage = ConfigLoader::getInstance().getProjectileArchetype(GameTypes::ProjectileType::Bullet).damage;
 }
 
 void HeavyGunnerMember::initializeAnimation() {
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* idleAnim = animSystem.getAnimation("HeavyGunnerIdle")) {
-        m_animationComponent.play(*idleAnim, "HeavyGunnerIdle");
+    m_animationHandle = animSystem.registerSquadMember(this);   // Single instance, stepped by AnimationSystem
+    m_idleClip = animSystem.getAnimationId("HeavyGunnerIdle");
+    m_shootClip = animSystem.getAnimationId("HeavyGunnerShoot");
+    m_deadClip = animSystem.getAnimationId("HeavyGunnerDead");
+
+    if (animSystem.playAnimation(m_animationHandle, m_idleClip)) {
         m_animationState = AnimationState::Idle;
     }
 }
 
 void HeavyGunnerMember::setupAnimationCallbacks() {
-    m_animationComponent.setAnimationCompleteCallback([this]() {
+    AnimationSystem::getInstance().setAnimationCompleteCallback(m_animationHandle, [this]() {
         if (m_animationState == AnimationState::Shooting) {
             returnToIdleAnimation();
         }
@@ -52,7 +52,6 @@ void HeavyGunnerMember::setupAnimationCallbacks() {
 
 void HeavyGunnerMember::update(float dt) {
     SquadMember::update(dt);
-    m_animationComponent.update(dt);
 
     if (isDestroyed() || m_isDying) {
         return;
@@ -84,7 +83,7 @@ void HeavyGunnerMember::updateFiring(float dt) {
 }
 
 void HeavyGunnerMember::updateAnimation(float dt) {
-    m_animationComponent.setPosition(getPosition());
+    AnimationSystem::getInstance().updateEntityPosition(m_animationHandle, getPosition());
 }
 
 bool HeavyGunnerMember::hasValidTarget() const {
@@ -98,7 +97,7 @@ void HeavyGunnerMember::fireBullet() {
     if (!hasValidTarget()) return;
 
     startShootingAnimation();
-    AudioManager::getInstance().playSound("heavy_gunner_shot", AudioManager::AudioCategory::SFX, 0.3f);
+    AudioManager::getInstance().playSound(SoundId::HeavyGunnerShot, AudioManager::AudioCategory::SFX, 0.3f);
 
     auto& projectileManager = ProjectileManager::getInstance();
     projectileManager.fireProjectile(
@@ -113,8 +112,7 @@ void HeavyGunnerMember::startShootingAnimation() {
     if (m_animationState == AnimationState::Shooting) return;
 
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* shootAnim = animSystem.getAnimation("HeavyGunnerShoot")) {
-        m_animationComponent.play(*shootAnim, "HeavyGunnerShoot");
+    if (animSystem.playAnimation(m_animationHandle, m_shootClip)) {
         m_animationState = AnimationState::Shooting;
     }
 }
@@ -123,18 +121,11 @@ void HeavyGunnerMember::returnToIdleAnimation() {
     if (m_animationState == AnimationState::Idle) return;
 
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* idleAnim = animSystem.getAnimation("HeavyGunnerIdle")) {
-        m_animationComponent.play(*idleAnim, "HeavyGunnerIdle");
+    if (animSystem.playAnimation(m_animationHandle, m_idleClip)) {
         m_animationState = AnimationState::Idle;
     }
 }
 
-void HeavyGunnerMember::draw(sf::RenderWindow& window) const {
-    m_animationComponent.setPosition(getPosition());
-    m_animationComponent.draw(window);
-    SquadMember::draw(window);
-}
-
 void HeavyGunnerMember::attack(const std::vector<std::unique_ptr<Robot>>& robots) {
     m_visibleRobots = &robots;
 }
@@ -170,10 +161,9 @@ void HeavyGunnerMember::setNearbyRobots(const std::vector<std::unique_ptr<Robot>
 
 void HeavyGunnerMember::playDeathAnimation() {
     if (m_animationState == AnimationState::Dead) return;
-    AudioManager::getInstance().playSound("squad_died");
+    AudioManager::getInstance().playSound(SoundId::SquadDied);
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* deathAnim = animSystem.getAnimation("HeavyGunnerDead")) {
-        m_animationComponent.play(*deathAnim, "HeavyGunnerDead");
+    if (animSystem.playAnimation(m_animationHandle, m_deadClip)) {
         m_animationState = AnimationState::Dead;
     }
     else {
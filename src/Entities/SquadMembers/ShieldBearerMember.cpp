@@ -1,6 +1,5 @@
 ﻿#include "Entities/SquadMembers/ShieldBearerMember.h"
 #include "Entities/Base/Robot.h"
-#include "Graphics/AnimationComponent.h"
 #include "Systems/AnimationSystem.h"
 #include "Managers/AudioManager.h"
 #include "Utils/ConfigLoader.h"
@@ -8,7 +7,6 @@
 
 ShieldBearerMember::ShieldBearerMember()
     : SquadMember(GameTypes::SquadMemberType::ShieldBearer, 50, 100.0f, 15)
-    , m_animationComponent(this)
     , m_animationState(AnimationState::Idle)
     , m_visibleRobots(nullptr)
     , m_robotNear(false)
@@ -16,23 +14,26 @@ ShieldBearerMember::ShieldBearerMember()
     initializeFromConfig();
     initializeAnimation();
     setupAnimationCallbacks();
-    AnimationSystem::getInstance().registerSquadMember(this);
 }
 
 void ShieldBearerMember::initializeFromConfig() {
-    initializeConfigFromName("ShieldBearer", 0.0f);
+    initializeConfigFromArchetype();
 }
 
 void ShieldBearerMember::initializeAnimation() {
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* idleAnim = animSystem.getAnimation("ShieldBearerIdle")) {
-        m_animationComponent.play(*idleAnim, "ShieldBearerIdle");
+    m_animationHandle = animSystem.registerSquadMember(this);   // Single instance, stepped by AnimationSystem
+    m_idleClip = animSystem.getAnimationId("ShieldBearerIdle");
+    m_blockClip = animSystem.getAnimationId("ShieldBearerBlock");
+    m_deadClip = animSystem.getAnimationId("ShieldBearerDead");
+
+    if (animSystem.playAnimation(m_animationHandle, m_idleClip)) {
         m_animationState = AnimationState::Idle;
     }
 }
 
 void ShieldBearerMember::setupAnimationCallbacks() {
-    m_animationComponent.setAnimationCompleteCallback([this]() {
+    AnimationSystem::getInstance().setAnimationCompleteCallback(m_animationHandle, [this]() {
         if (m_animationState == AnimationState::Blocking) {
             returnToIdleAnimation();
         }
@@ -44,7 +45,6 @@ void ShieldBearerMember::setupAnimationCallbacks() {
 
 void ShieldBearerMember::update(float dt) {
     SquadMember::update(dt);
-    m_animationComponent.update(dt);
 
     if (isDestroyed() || m_isDying) {
         return;
@@ -78,7 +78,7 @@ void ShieldBearerMember::updateRobotDetection(float dt) {
     if (robotDetected && !m_robotNear) {
         m_robotNear = true;
         switchToBlockingAnimation();
-        AudioManager::getInstance().playSound("shield_barier_fight", AudioManager::AudioCategory::SFX);
+        AudioManager::getInstance().playSound(SoundId::ShieldBarrierFight, AudioManager::AudioCategory::SFX);
     }
     else if (!robotDetected && m_robotNear) {
         m_robotNear = false;
@@ -87,15 +87,14 @@ void ShieldBearerMember::updateRobotDetection(float dt) {
 }
 
 void ShieldBearerMember::updateAnimation(float dt) {
-    m_animationComponent.setPosition(getPosition());
+    AnimationSystem::getInstance().updateEntityPosition(m_animationHandle, getPosition());
 }
 
 void ShieldBearerMember::switchToBlockingAnimation() {
     if (m_animationState == AnimationState::Blocking) return;
 
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* blockAnim = animSystem.getAnimation("ShieldBearerBlock")) {
-        m_animationComponent.play(*blockAnim, "ShieldBearerBlock");
+    if (animSystem.playAnimation(m_animationHandle, m_blockClip)) {
         m_animationState = AnimationState::Blocking;
     }
 }
@@ -104,18 +103,11 @@ void ShieldBearerMember::returnToIdleAnimation() {
     if (m_animationState == AnimationState::Idle) return;
 
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* idleAnim = animSystem.getAnimation("ShieldBearerIdle")) {
-        m_animationComponent.play(*idleAnim, "ShieldBearerIdle");
+    if (animSystem.playAnimation(m_animationHandle, m_idleClip)) {
         m_animationState = AnimationState::Idle;
     }
 }
 
-void ShieldBearerMember::draw(sf::RenderWindow& window) const {
-    m_animationComponent.setPosition(getPosition());
-    m_animationComponent.draw(window);
-    SquadMember::draw(window);
-}
-
 void ShieldBearerMember::attack(const std::vector<std::unique_ptr<Robot>>& robots) {
     m_visibleRobots = &robots;
 }
@@ -130,10 +122,9 @@ void ShieldBearerMember::setNearbyRobots(const std::vector<std::unique_ptr<Robot
 
 void ShieldBearerMember::playDeathAnimation() {
     if (m_animationState == AnimationState::Dead) return;
-    AudioManager::getInstance().playSound("shield_died");
+    AudioManager::getInstance().playSound(SoundId::ShieldDied);
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* deathAnim = animSystem.getAnimation("ShieldBearerDead")) {
-        m_animationComponent.play(*deathAnim, "ShieldBearerDead");
+    if (animSystem.playAnimation(m_animationHandle, m_deadClip)) {
         m_animationState = AnimationState::Dead;
     }
     else {
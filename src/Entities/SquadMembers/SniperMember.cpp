@@ -1,6 +1,5 @@
 ﻿#include "Entities/SquadMembers/SniperMember.h"
 #include "Entities/Base/Robot.h"
-#include "Graphics/AnimationComponent.h"
 #include "Systems/AnimationSystem.h"
 #include "Managers/ProjectileManager.h"
 #include "Managers/AudioManager.h"
@@ -9,7 +8,6 @@
 
 SniperMember::SniperMember()
     : SquadMember(GameTypes::SquadMemberType::Sniper, 60, 250.0f, 50)
-    , m_animationComponent(this)
     , m_attackDelay(2.5f)
     , m_canFire(true)
     , m_currentTarget(nullptr)
@@ -19,28 +17,30 @@ SniperMember::SniperMember()
     initializeFromConfig();
     initializeAnimation();
     setupAnimationCallbacks();
-    AnimationSystem::getInstance().registerSquadMember(this);
     m_attackTimer.setDuration(m_attackDelay);
     m_attackTimer.restart();
 }
 
 void SniperMember::initializeFromConfig() {
-    initializeConfigFromName("Sniper", 2.5f);
+    initializeConfigFromArchetype();
 
-    auto& config = ConfigLoader::getInstance();
-    m_damage = config.getInt("SniperBullet", "damage", 40);
+    m_damage = ConfigLoader::getInstance().getProjectileArchetype(GameTypes::ProjectileType::SniperBullet).damage;
 }
 
 void SniperMember::initializeAnimation() {
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* idleAnim = animSystem.getAnimation("SniperIdle")) {
-        m_animationComponent.play(*idleAnim, "SniperIdle");
+    m_animationHandle = animSystem.registerSquadMember(this);   // Single instance, stepped by AnimationSystem
+    m_idleClip = animSystem.getAnimationId("SniperIdle");
+    m_shootClip = animSystem.getAnimationId("SniperShoot");
+    m_deadClip = animSystem.getAnimationId("SniperDead");
+
+    if (animSystem.playAnimation(m_animationHandle, m_idleClip)) {
         m_animationState = AnimationState::Idle;
     }
 }
 
 void SniperMember::setupAnimationCallbacks() {
-    m_animationComponent.setAnimationCompleteCallback([this]() {
+    AnimationSystem::getInstance().setAnimationCompleteCallback(m_animationHandle, [this]() {
         if (m_animationState == AnimationState::Shooting) {
             returnToIdleAnimation();
         }
@@ -52,7 +52,6 @@ void SniperMember::setupAnimationCallbacks() {
 
 void SniperMember::update(float dt) {
     SquadMember::update(dt);
-    m_animationComponent.update(dt);
 
     if (isDestroyed() || m_isDying) {
         return;
@@ -84,7 +83,7 @@ void SniperMember::updateFiring(float dt) {
 }
 
 void SniperMember::updateAnimation(float dt) {
-    m_animationComponent.setPosition(getPosition());
+    AnimationSystem::getInstance().updateEntityPosition(m_animationHandle, getPosition());
 }
 
 bool SniperMember::hasValidTarget() const {
@@ -98,7 +97,7 @@ void SniperMember::fireBullet() {
     if (!hasValidTarget()) return;
 
     startShootingAnimation();
-    AudioManager::getInstance().playSound("sniper_shot", AudioManager::AudioCategory::SFX, 0.3f);
+    AudioManager::getInstance().playSound(SoundId::SniperShot, AudioManager::AudioCategory::SFX, 0.3f);
 
     auto& projectileManager = ProjectileManager::getInstance();
     projectileManager.fireProjectile(
@@ -113,8 +112,7 @@ void SniperMember::startShootingAnimation() {
     if (m_animationState == AnimationState::Shooting) return;
 
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* shootAnim = animSystem.getAnimation("SniperShoot")) {
-        m_animationComponent.play(*shootAnim, "SniperShoot");
+    if (animSystem.playAnimation(m_animationHandle, m_shootClip)) {
         m_animationState = AnimationState::Shooting;
     }
 }
@@ -123,18 +121,11 @@ void SniperMember::returnToIdleAnimation() {
     if (m_animationState == AnimationState::Idle) return;
 
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* idleAnim = animSystem.getAnimation("SniperIdle")) {
-        m_animationComponent.play(*idleAnim, "SniperIdle");
+    if (animSystem.playAnimation(m_animationHandle, m_idleClip)) {
         m_animationState = AnimationState::Idle;
     }
 }
 
-void SniperMember::draw(sf::RenderWindow& window) const {
-    m_animationComponent.setPosition(getPosition());
-    m_animationComponent.draw(window);
-    SquadMember::draw(window);
-}
-
 void SniperMember::attack(const std::vector<std::unique_ptr<Robot>>& robots) {
     m_visibleRobots = &robots;
 }
@@ -170,10 +161,9 @@ void SniperMember::setNearbyRobots(const std::vector<std::unique_ptr<Robot>>* ro
 
 void SniperMember::playDeathAnimation() {
     if (m_animationState == AnimationState::Dead) return;
-    AudioManager::getInstance().playSound("squad_died");
+    AudioManager::getInstance().playSound(SoundId::SquadDied);
     auto& animSystem = AnimationSystem::getInstance();
-    if (const Animation* deathAnim = animSystem.getAnimation("SniperDead")) {
-        m_animationComponent.play(*deathAnim, "SniperDead");
+    if (animSystem.playAnimation(m_animationHandle, m_deadClip)) {
         m_animationState = AnimationState::Dead;
     }
     else {
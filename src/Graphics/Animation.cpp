@@ -2,6 +2,8 @@
 // src/Graphics/Animation.cpp
 // ================================
 #include "Graphics/Animation.h"
+#include <algorithm>
+#include <numeric>
 
 Animation::Animation(const sf::Texture& texture, int frameWidth, int frameHeight, int frameCount, float duration)
     : m_texture(texture), m_frameCount(frameCount), m_duration(duration) {
@@ -26,6 +28,10 @@ Animation::Animation(const sf::Texture& texture, int frameWidth, int frameHeight
     }
 }
 
+Animation::Animation(const sf::Texture& texture, const std::vector<sf::IntRect>& frames, float duration)
+    : m_texture(texture), m_frames(frames), m_frameCount(static_cast<int>(frames.size())), m_duration(duration) {
+}
+
 void Animation::update(float dt) {
 }
 
@@ -48,4 +54,26 @@ int Animation::getFrameCount() const {
 
 float Animation::getDuration() const {
     return m_duration;
+}
+
+void Animation::setFrameDurations(const std::vector<float>& durations) {
+    if (static_cast<int>(durations.size()) != m_frameCount) return;
+
+    m_frameEndTimes.resize(durations.size());
+    std::partial_sum(durations.begin(), durations.end(), m_frameEndTimes.begin());
+    m_duration = m_frameEndTimes.empty() ? 0.0f : m_frameEndTimes.back();
+}
+
+int Animation::getFrameAt(float time) const {
+    if (m_frameCount <= 0 || m_duration <= 0.0f) return 0;
+
+    int frame;
+    if (m_frameEndTimes.empty()) {
+        frame = static_cast<int>(time * m_frameCount / m_duration);
+    }
+    else {
+        auto it = std::upper_bound(m_frameEndTimes.begin(), m_frameEndTimes.end(), time);
+        frame = static_cast<int>(it - m_frameEndTimes.begin());
+    }
+    return std::clamp(frame, 0, m_frameCount - 1);
 }
\ No newline at end of file
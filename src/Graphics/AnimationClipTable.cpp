@@ -0,0 +1,254 @@
+// ================================
+// src/Graphics/AnimationClipTable.cpp
+// ================================
+#include "Graphics/AnimationClipTable.h"
+#include "Graphics/Animation.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    const char CLIP_CACHE_MAGIC[4] = { 'C', 'L', 'I', 'P' };
+    const std::uint32_t CLIP_CACHE_VERSION = 1;
+
+    std::string trimClipLine(const std::string& str) {
+        size_t first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+        size_t last = str.find_last_not_of(" \t\r\n");
+        return str.substr(first, last - first + 1);
+    }
+
+    bool parseClipBool(const std::string& value) {
+        return value == "true" || value == "1" || value == "yes";
+    }
+}
+
+bool AnimationClipTable::load(const std::string& sourceFile, const std::string& cacheFile) {
+    close();
+
+    // A stamp of 0 means the .cfg is not present; any valid cache is accepted then
+    const std::uint64_t stamp = sourceStamp(sourceFile);
+
+    if (m_mapping.open(cacheFile)) {
+        if (attach(m_mapping.data(), m_mapping.size(), stamp)) {
+            return true;
+        }
+        m_mapping.close();   // Stale or corrupt - rebuild below
+    }
+
+    if (stamp == 0) {
+        std::cerr << "Animation clips: neither " << sourceFile << " nor a valid " << cacheFile << " found" << std::endl;
+        return false;
+    }
+
+    std::vector<ClipDefinition> clips;
+    if (!parseSource(sourceFile, clips)) {
+        return false;
+    }
+    m_compiled = compile(clips, stamp);
+
+    std::ofstream out(cacheFile, std::ios::binary | std::ios::trunc);
+    if (out.write(reinterpret_cast<const char*>(m_compiled.data()), static_cast<std::streamsize>(m_compiled.size()))) {
+        out.close();
+        if (m_mapping.open(cacheFile) && attach(m_mapping.data(), m_mapping.size(), stamp)) {
+            m_compiled.clear();
+            m_compiled.shrink_to_fit();
+            return true;
+        }
+        m_mapping.close();
+    }
+    else {
+        std::cerr << "Animation clips: cannot write cache " << cacheFile << ", using in-memory table" << std::endl;
+    }
+
+    return attach(m_compiled.data(), m_compiled.size(), stamp);
+}
+
+void AnimationClipTable::close() {
+    m_mapping.close();
+    m_compiled.clear();
+    m_header = nullptr;
+    m_clips = nullptr;
+    m_floats = nullptr;
+    m_strings = nullptr;
+}
+
+size_t AnimationClipTable::getClipCount() const {
+    return m_header ? m_header->clipCount : 0;
+}
+
+const AnimationClipTable::ClipRecord& AnimationClipTable::getClip(size_t index) const {
+    return m_clips[index];
+}
+
+const char* AnimationClipTable::getString(std::uint32_t offset) const {
+    return m_strings + offset;
+}
+
+std::vector<float> AnimationClipTable::getFrameDurations(const ClipRecord& clip) const {
+    const float* first = m_floats + clip.frameDurationIndex;
+    return std::vector<float>(first, first + clip.frameDurationCount);
+}
+
+std::uint64_t AnimationClipTable::sourceStamp(const std::string& sourceFile) {
+    std::error_code error;
+    auto size = std::filesystem::file_size(sourceFile, error);
+    if (error) return 0;
+    auto writeTime = std::filesystem::last_write_time(sourceFile, error);
+    if (error) return 0;
+
+    std::uint64_t stamp = static_cast<std::uint64_t>(writeTime.time_since_epoch().count());
+    stamp ^= static_cast<std::uint64_t>(size) * 0x9E3779B97F4A7C15ull;
+    return stamp | 1;   // Never 0
+}
+
+// Validate a compiled table and point the accessors into it
+bool AnimationClipTable::attach(const std::uint8_t* data, size_t size, std::uint64_t expectedStamp) {
+    if (!data || size < sizeof(Header)) return false;
+
+    const Header* header = reinterpret_cast<const Header*>(data);
+    if (std::memcmp(header->magic, CLIP_CACHE_MAGIC, sizeof(CLIP_CACHE_MAGIC)) != 0 ||
+        header->version != CLIP_CACHE_VERSION ||
+        (expectedStamp != 0 && header->sourceStamp != expectedStamp)) {
+        return false;
+    }
+
+    const size_t recordsBytes = static_cast<size_t>(header->clipCount) * sizeof(ClipRecord);
+    const size_t floatsBytes = static_cast<size_t>(header->floatCount) * sizeof(float);
+    if (size != sizeof(Header) + recordsBytes + floatsBytes + header->stringBytes ||
+        header->stringBytes == 0) {
+        return false;
+    }
+
+    const ClipRecord* clips = reinterpret_cast<const ClipRecord*>(data + sizeof(Header));
+    const float* floats = reinterpret_cast<const float*>(data + sizeof(Header) + recordsBytes);
+    const char* strings = reinterpret_cast<const char*>(data + sizeof(Header) + recordsBytes + floatsBytes);
+
+    if (strings[header->stringBytes - 1] != '\0') return false;
+    for (std::uint32_t i = 0; i < header->clipCount; ++i) {
+        const ClipRecord& clip = clips[i];
+        if (clip.nameOffset >= header->stringBytes || clip.sheetOffset >= header->stringBytes ||
+            clip.frameCount <= 0 ||
+            static_cast<std::uint64_t>(clip.frameDurationIndex) + clip.frameDurationCount > header->floatCount) {
+            return false;
+        }
+    }
+
+    m_header = header;
+    m_clips = clips;
+    m_floats = floats;
+    m_strings = strings;
+    return true;
+}
+
+bool AnimationClipTable::parseSource(const std::string& sourceFile, std::vector<ClipDefinition>& clips) {
+    std::ifstream file(sourceFile);
+    if (!file.is_open()) {
+        std::cerr << "Animation clips: cannot open " << sourceFile << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        line = trimClipLine(line);
+        if (line.empty() || line[0] == '#' || line[0] == ';') continue;
+
+        if (line.front() == '[' && line.back() == ']') {
+            ClipDefinition clip;
+            clip.name = trimClipLine(line.substr(1, line.size() - 2));
+            clips.push_back(clip);
+            continue;
+        }
+
+        size_t equalPos = line.find('=');
+        if (equalPos == std::string::npos || clips.empty()) continue;
+
+        ClipDefinition& clip = clips.back();
+        std::string key = trimClipLine(line.substr(0, equalPos));
+        std::string value = trimClipLine(line.substr(equalPos + 1));
+
+        try {
+            if (key == "sheet") clip.sheet = value;
+            else if (key == "frames") clip.frameCount = std::stoi(value);
+            else if (key == "frameWidth") clip.frameWidth = std::stoi(value);
+            else if (key == "frameHeight") clip.frameHeight = std::stoi(value);
+            else if (key == "duration") clip.duration = std::stof(value);
+            else if (key == "loop") clip.loop = parseClipBool(value);
+            else if (key == "flipX") clip.flipX = parseClipBool(value);
+            else if (key == "frameDurations") {
+                std::stringstream stream(value);
+                std::string item;
+                while (std::getline(stream, item, ',')) {
+                    clip.frameDurations.push_back(std::stof(trimClipLine(item)));
+                }
+            }
+        }
+        catch (const std::exception&) {
+            std::cerr << "Animation clips: bad value in " << sourceFile << " [" << clip.name << "] " << line << std::endl;
+            return false;
+        }
+    }
+
+    for (const auto& clip : clips) {
+        if (clip.sheet.empty() || clip.frameCount <= 0) {
+            std::cerr << "Animation clips: [" << clip.name << "] needs a sheet and a positive frame count" << std::endl;
+            return false;
+        }
+        if (!clip.frameDurations.empty() && static_cast<int>(clip.frameDurations.size()) != clip.frameCount) {
+            std::cerr << "Animation clips: [" << clip.name << "] frameDurations must list " << clip.frameCount << " values" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::uint8_t> AnimationClipTable::compile(const std::vector<ClipDefinition>& clips, std::uint64_t stamp) {
+    std::vector<ClipRecord> records;
+    std::vector<float> floats;
+    std::string strings;
+
+    for (const auto& clip : clips) {
+        ClipRecord record{};
+        record.nameOffset = static_cast<std::uint32_t>(strings.size());
+        strings.append(clip.name).push_back('\0');
+        record.sheetOffset = static_cast<std::uint32_t>(strings.size());
+        strings.append(clip.sheet).push_back('\0');
+
+        record.frameCount = clip.frameCount;
+        record.frameWidth = clip.frameWidth;
+        record.frameHeight = clip.frameHeight;
+        record.duration = clip.duration;
+        record.flags = (clip.loop ? AnimationFlags::Loop : AnimationFlags::None) |
+            (clip.flipX ? AnimationFlags::FlipX : AnimationFlags::None);
+        record.frameDurationIndex = static_cast<std::uint32_t>(floats.size());
+        record.frameDurationCount = static_cast<std::uint32_t>(clip.frameDurations.size());
+        floats.insert(floats.end(), clip.frameDurations.begin(), clip.frameDurations.end());
+
+        records.push_back(record);
+    }
+    if (strings.empty()) strings.push_back('\0');
+
+    Header header{};
+    std::memcpy(header.magic, CLIP_CACHE_MAGIC, sizeof(CLIP_CACHE_MAGIC));
+    header.version = CLIP_CACHE_VERSION;
+    header.sourceStamp = stamp;
+    header.clipCount = static_cast<std::uint32_t>(records.size());
+    header.floatCount = static_cast<std::uint32_t>(floats.size());
+    header.stringBytes = static_cast<std::uint32_t>(strings.size());
+
+    const size_t recordsBytes = records.size() * sizeof(ClipRecord);
+    const size_t floatsBytes = floats.size() * sizeof(float);
+    std::vector<std::uint8_t> data(sizeof(Header) + recordsBytes + floatsBytes + strings.size());
+
+    std::uint8_t* out = data.data();
+    std::memcpy(out, &header, sizeof(Header));
+    out += sizeof(Header);
+    if (recordsBytes) std::memcpy(out, records.data(), recordsBytes);
+    out += recordsBytes;
+    if (floatsBytes) std::memcpy(out, floats.data(), floatsBytes);
+    out += floatsBytes;
+    std::memcpy(out, strings.data(), strings.size());
+    return data;
+}
@@ -4,17 +4,21 @@
 #include "Graphics/AnimationComponent.h"
 #include "Graphics/Animation.h" 
 #include "Core/Constants.h" 
+#include <algorithm>
+#include <cmath>
 
 AnimationComponent::AnimationComponent(void* owner)
     : m_owner(owner) {
 }
 
-void AnimationComponent::play(const Animation& animation, const std::string& animationName) {
+void AnimationComponent::play(const Animation& animation, AnimationId animationId) {
     m_currentAnimation = &animation;
-    m_currentAnimationName = animationName;
+    m_currentAnimationId = animationId;
     m_time = 0.f;
     m_currentFrame = 0;
     m_previousFrame = -1;
+    m_completed = false;
+    m_holding = false;
 
     m_sprite.setTexture(animation.getTexture());
     m_sprite.setTextureRect(animation.getFrame(0));
@@ -25,56 +29,65 @@ void AnimationComponent::play(const Animation& animation, const std::string& ani
     float targetSize = GameConstants::GRID_CELL_HEIGHT;
     float baseScale = targetSize / std::max(frame.width, frame.height);
 
-    bool shouldFlipHorizontally = needsHorizontalFlip();
-    float scaleX = shouldFlipHorizontally ? -baseScale : baseScale;
+    float scaleX = animation.isFlippedX() ? -baseScale : baseScale;
     float scaleY = baseScale;
 
     m_sprite.setScale(scaleX, scaleY);
 }
 
+// Looping clips wrap their clock and report completion once per cycle;
+// one-shot clips park on the last frame and report it once.
 void AnimationComponent::update(float dt) {
-    if (!m_currentAnimation || m_paused) return;
-
-    float adjustedDt = dt * m_animationSpeed;
-    m_time += adjustedDt;
+    advance(dt, nullptr);
+}
 
-    float frameTime = m_currentAnimation->getDuration() / m_currentAnimation->getFrameCount();
+void AnimationComponent::update(float dt, std::vector<AnimationCallback>& fired) {
+    advance(dt, &fired);
+}
 
-    int newFrame = static_cast<int>((m_time / frameTime)) % m_currentAnimation->getFrameCount();
+void AnimationComponent::advance(float dt, std::vector<AnimationCallback>* fired) {
+    if (!m_currentAnimation || m_paused || m_holding) return;
 
-    bool isDeathAnimation = m_currentAnimationName.find("Death") != std::string::npos ||
-        m_currentAnimationName.find("Dead") != std::string::npos;
+    const Animation& clip = *m_currentAnimation;
+    const float duration = clip.getDuration();
+    m_time += dt * m_animationSpeed;
 
     bool animationCompleted = false;
+    int newFrame;
 
-    if (isDeathAnimation) {
-        float totalTime = m_currentAnimation->getDuration();
-        if (m_time >= totalTime) {
-            newFrame = m_currentAnimation->getFrameCount() - 1;
-            animationCompleted = true;
+    if (m_time >= duration) {
+        animationCompleted = true;
+        m_completed = true;
+
+        if (clip.isLooping() && duration > 0.f) {
+            m_time = std::fmod(m_time, duration);
+            newFrame = clip.getFrameAt(m_time);
+        }
+        else {
+            m_time = duration;
+            m_holding = true;
+            newFrame = clip.getFrameCount() - 1;
         }
     }
     else {
-        if (m_time >= m_currentAnimation->getDuration()) {
-            animationCompleted = true;
-        }
+        newFrame = clip.getFrameAt(m_time);
     }
 
     if (newFrame != m_currentFrame) {
         m_previousFrame = m_currentFrame;
         m_currentFrame = newFrame;
-        m_sprite.setTextureRect(m_currentAnimation->getFrame(m_currentFrame));
-        checkFrameCallbacks();
+        m_sprite.setTextureRect(clip.getFrame(m_currentFrame));
+        checkFrameCallbacks(fired);
     }
 
     if (animationCompleted) {
-        checkAnimationComplete();
+        checkAnimationComplete(fired);
     }
 }
 
-void AnimationComponent::draw(sf::RenderWindow& window) const {
+void AnimationComponent::queueDraw() const {
     if (m_currentAnimation && m_sprite.getTexture()) {
-        window.draw(m_sprite);
+        RenderQueue::getInstance().submit(m_renderLayer, m_sprite);
     }
 }
 
@@ -84,23 +97,6 @@ void AnimationComponent::setPosition(const sf::Vector2f& pos) {
     m_sprite.setPosition(adjustedPos);
 }
 
-bool AnimationComponent::needsHorizontalFlip() const {
-    if (m_currentAnimationName.find("FireRobot") != std::string::npos) {
-        return true;
-    }
-
-    if (m_currentAnimationName.find("BasicRobot") != std::string::npos ||
-        m_currentAnimationName.find("RockRobot") != std::string::npos) {
-        return true;
-    }
-
-    if (m_currentAnimationName.find("StealthRobot") != std::string::npos) {
-        return true;
-    }
-
-    return false;
-}
-
 bool AnimationComponent::isLastFrame() const {
     if (!m_currentAnimation) return false;
     return m_currentFrame == (m_currentAnimation->getFrameCount() - 1);
@@ -108,9 +104,7 @@ bool AnimationComponent::isLastFrame() const {
 
 bool AnimationComponent::isAnimationComplete() const {
     if (!m_currentAnimation) return true;
-
-    float totalDuration = m_currentAnimation->getDuration();
-    return m_time >= totalDuration;
+    return m_completed;
 }
 
 void AnimationComponent::setFrameCallback(int frameIndex, FrameCallback callback) {
@@ -126,15 +120,25 @@ void AnimationComponent::clearCallbacks() {
     m_animationCompleteCallback = nullptr;
 }
 
-void AnimationComponent::checkFrameCallbacks() {
+void AnimationComponent::checkFrameCallbacks(std::vector<AnimationCallback>* fired) {
     auto it = m_frameCallbacks.find(m_currentFrame);
-    if (it != m_frameCallbacks.end() && it->second) {
+    if (it == m_frameCallbacks.end() || !it->second) return;
+
+    if (fired) {
+        fired->push_back([callback = it->second, frame = m_currentFrame]() { callback(frame); });
+    }
+    else {
         it->second(m_currentFrame);
     }
 }
 
-void AnimationComponent::checkAnimationComplete() {
-    if (m_animationCompleteCallback) {
+void AnimationComponent::checkAnimationComplete(std::vector<AnimationCallback>* fired) {
+    if (!m_animationCompleteCallback) return;
+
+    if (fired) {
+        fired->push_back(m_animationCompleteCallback);
+    }
+    else {
         m_animationCompleteCallback();
     }
 }
@@ -0,0 +1,65 @@
+// ================================
+// src/Graphics/HealthBarBatch.cpp
+// ================================
+#include "Graphics/HealthBarBatch.h"
+
+namespace {
+    const float BAR_WIDTH = 50.0f;
+    const float BAR_HEIGHT = 8.0f;
+    const float BAR_OFFSET_X = 25.0f;
+    const float BAR_OFFSET_Y = 95.0f;
+    const float OUTLINE_THICKNESS = 1.0f;
+    const sf::Color OUTLINE_COLOR(50, 50, 50, 150);
+}
+
+HealthBarBatch& HealthBarBatch::getInstance() {
+    static HealthBarBatch instance;
+    return instance;
+}
+
+HealthBarBatch::HealthBarBatch()
+    : m_vertices(sf::Quads) {
+}
+
+void HealthBarBatch::addBar(const sf::Vector2f& entityPosition, float healthPercent) {
+    const float x = entityPosition.x - BAR_OFFSET_X;
+    const float y = entityPosition.y - BAR_OFFSET_Y;
+    const float t = OUTLINE_THICKNESS;
+
+    // Outline drawn outside the bar, same as RectangleShape's outline
+    appendQuad(x - t, y - t, BAR_WIDTH + 2 * t, t, OUTLINE_COLOR);      // Top
+    appendQuad(x - t, y + BAR_HEIGHT, BAR_WIDTH + 2 * t, t, OUTLINE_COLOR); // Bottom
+    appendQuad(x - t, y, t, BAR_HEIGHT, OUTLINE_COLOR);                 // Left
+    appendQuad(x + BAR_WIDTH, y, t, BAR_HEIGHT, OUTLINE_COLOR);         // Right
+
+    if (healthPercent > 0.0f) {
+        appendQuad(x, y, BAR_WIDTH * healthPercent, BAR_HEIGHT, colorForPercent(healthPercent));
+    }
+    ++m_barCount;
+}
+
+void HealthBarBatch::flush(sf::RenderTarget& target) {
+    if (m_vertices.getVertexCount() > 0) {
+        target.draw(m_vertices);
+    }
+    clear();
+}
+
+void HealthBarBatch::clear() {
+    m_vertices.clear();
+    m_barCount = 0;
+}
+
+void HealthBarBatch::appendQuad(float x, float y, float width, float height, const sf::Color& color) {
+    m_vertices.append(sf::Vertex(sf::Vector2f(x, y), color));
+    m_vertices.append(sf::Vertex(sf::Vector2f(x + width, y), color));
+    m_vertices.append(sf::Vertex(sf::Vector2f(x + width, y + height), color));
+    m_vertices.append(sf::Vertex(sf::Vector2f(x, y + height), color));
+}
+
+sf::Color HealthBarBatch::colorForPercent(float healthPercent) {
+    if (healthPercent > 0.75f) return sf::Color::Green;
+    if (healthPercent > 0.5f) return sf::Color(128, 255, 0);
+    if (healthPercent > 0.25f) return sf::Color::Yellow;
+    return sf::Color::Red;
+}
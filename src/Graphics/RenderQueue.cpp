@@ -0,0 +1,148 @@
+// ================================
+// src/Graphics/RenderQueue.cpp
+// ================================
+#include "Graphics/RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Key layout: [63..56] layer | [55..32] y-depth | [31..16] texture id | [15..0] unused
+    const int LAYER_SHIFT = 56;
+    const int DEPTH_SHIFT = 32;
+    const int TEXTURE_SHIFT = 16;
+    const int FIRST_KEY_BYTE = 2;                  // Lower bytes are always zero
+    const float DEPTH_SCALE = 4.0f;                // Quarter-pixel depth resolution
+    const std::uint32_t DEPTH_BIAS = 1u << 23;     // Lets negative y sort before zero
+    const std::uint32_t DEPTH_MAX = (1u << 24) - 1;
+}
+
+RenderQueue& RenderQueue::getInstance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+RenderQueue::RenderQueue()
+    : m_batch(sf::Quads) {
+}
+
+std::uint64_t RenderQueue::makeKey(RenderLayer layer, float depth, const sf::Texture* texture) {
+    float scaled = std::round(depth * DEPTH_SCALE) + static_cast<float>(DEPTH_BIAS);
+    std::uint32_t depthBits = static_cast<std::uint32_t>(std::clamp(scaled, 0.0f, static_cast<float>(DEPTH_MAX)));
+
+    // GL texture names are small integers, so the low bits identify the texture cheaply
+    std::uint64_t textureBits = texture ? (texture->getNativeHandle() & 0xFFFFu) : 0u;
+
+    return (static_cast<std::uint64_t>(layer) << LAYER_SHIFT) |
+        (static_cast<std::uint64_t>(depthBits) << DEPTH_SHIFT) |
+        (textureBits << TEXTURE_SHIFT);
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Sprite& sprite) {
+    submit(layer, sprite.getPosition().y, sprite);
+}
+
+void RenderQueue::submit(RenderLayer layer, float depth, const sf::Sprite& sprite) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    // Same corners and texture coordinates sf::Sprite builds internally
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const sf::FloatRect bounds = sprite.getLocalBounds();
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Color& color = sprite.getColor();
+
+    const float left = static_cast<float>(rect.left);
+    const float right = left + rect.width;
+    const float top = static_cast<float>(rect.top);
+    const float bottom = top + rect.height;
+
+    QueuedQuad quad;
+    quad.texture = texture;
+    quad.vertices[0] = sf::Vertex(transform.transformPoint(0.0f, 0.0f), color, sf::Vector2f(left, top));
+    quad.vertices[1] = sf::Vertex(transform.transformPoint(bounds.width, 0.0f), color, sf::Vector2f(right, top));
+    quad.vertices[2] = sf::Vertex(transform.transformPoint(bounds.width, bounds.height), color, sf::Vector2f(right, bottom));
+    quad.vertices[3] = sf::Vertex(transform.transformPoint(0.0f, bounds.height), color, sf::Vector2f(left, bottom));
+
+    push(makeKey(layer, depth, texture), quad);
+}
+
+void RenderQueue::submitRect(RenderLayer layer, const sf::FloatRect& rect, const sf::Color& color) {
+    QueuedQuad quad;
+    quad.vertices[0] = sf::Vertex(sf::Vector2f(rect.left, rect.top), color);
+    quad.vertices[1] = sf::Vertex(sf::Vector2f(rect.left + rect.width, rect.top), color);
+    quad.vertices[2] = sf::Vertex(sf::Vector2f(rect.left + rect.width, rect.top + rect.height), color);
+    quad.vertices[3] = sf::Vertex(sf::Vector2f(rect.left, rect.top + rect.height), color);
+
+    push(makeKey(layer, rect.top + rect.height / 2.0f, nullptr), quad);
+}
+
+void RenderQueue::push(std::uint64_t key, const QueuedQuad& quad) {
+    m_order.push_back({ key, static_cast<std::uint32_t>(m_quads.size()) });
+    m_quads.push_back(quad);
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    m_lastDrawCalls = 0;
+    if (m_quads.empty()) return;
+
+    radixSort();
+
+    // Draw each run of quads that share a texture as one vertex array
+    const sf::Texture* batchTexture = m_quads[m_order.front().index].texture;
+    m_batch.clear();
+
+    for (const auto& entry : m_order) {
+        const QueuedQuad& quad = m_quads[entry.index];
+        if (quad.texture != batchTexture) {
+            target.draw(m_batch, sf::RenderStates(batchTexture));
+            ++m_lastDrawCalls;
+            m_batch.clear();
+            batchTexture = quad.texture;
+        }
+        for (const auto& vertex : quad.vertices) {
+            m_batch.append(vertex);
+        }
+    }
+
+    target.draw(m_batch, sf::RenderStates(batchTexture));
+    ++m_lastDrawCalls;
+    clear();
+}
+
+void RenderQueue::clear() {
+    m_quads.clear();
+    m_order.clear();
+    m_batch.clear();
+}
+
+// LSD radix sort, one byte per pass. Passes where every key shares the same
+// byte are skipped, so a frame with one layer only pays for depth and texture.
+void RenderQueue::radixSort() {
+    const size_t count = m_order.size();
+    m_scratch.resize(count);
+
+    for (int byte = FIRST_KEY_BYTE; byte < 8; ++byte) {
+        const int shift = byte * 8;
+        std::array<size_t, 256> offsets{};
+
+        for (const auto& entry : m_order) {
+            ++offsets[(entry.key >> shift) & 0xFF];
+        }
+
+        if (offsets[(m_order.front().key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        size_t total = 0;
+        for (auto& offset : offsets) {
+            size_t bucket = offset;
+            offset = total;
+            total += bucket;
+        }
+
+        for (const auto& entry : m_order) {
+            m_scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+        m_order.swap(m_scratch);
+    }
+}
@@ -0,0 +1,190 @@
+// ================================
+// src/Graphics/TextureVariantCache.cpp
+// ================================
+#include "Graphics/TextureVariantCache.h"
+#include "Utils/AssetArchive.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+    const std::string VARIANT_CACHE_DIR = "texture_cache";
+
+    // Below this a variant is not worth a second file; saves at least ~20% of the pixels
+    const float MIN_DOWNSCALE_FACTOR = 0.9f;
+
+    const std::uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    const size_t PNG_HEADER_BYTES = 24;                  // Signature + IHDR length/type + width + height
+
+    std::uint32_t readBigEndian32(const std::uint8_t* bytes) {
+        return (std::uint32_t(bytes[0]) << 24) | (std::uint32_t(bytes[1]) << 16) |
+            (std::uint32_t(bytes[2]) << 8) | std::uint32_t(bytes[3]);
+    }
+
+    // Width and height from a PNG header, without decoding; (0,0) for other formats
+    sf::Vector2u readPngSize(const std::uint8_t* header, size_t size) {
+        if (size < PNG_HEADER_BYTES || std::memcmp(header, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0 ||
+            std::memcmp(header + 12, "IHDR", 4) != 0) {
+            return sf::Vector2u(0, 0);
+        }
+        return sf::Vector2u(readBigEndian32(header + 16), readBigEndian32(header + 20));
+    }
+
+    std::string fileStem(const std::string& filename) {
+        return std::filesystem::path(filename).stem().string();
+    }
+
+    // FNV-1a; packed sources have no timestamp, but their bytes are already mapped
+    std::uint64_t hashBytes(const std::uint8_t* bytes, size_t size) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::uint64_t lastWriteStamp(const std::string& filename) {
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(filename, error);
+        return error ? 0 : static_cast<std::uint64_t>(time.time_since_epoch().count());
+    }
+
+    std::string toHex(std::uint64_t value) {
+        static const char DIGITS[] = "0123456789abcdef";
+        std::string hex(16, '0');
+        for (int i = 15; i >= 0; --i, value >>= 4) {
+            hex[i] = DIGITS[value & 0xF];
+        }
+        return hex;
+    }
+}
+
+TextureVariantCache::Variant TextureVariantCache::select(const std::string& sourceFile, const sf::Vector2u& resolution) {
+    Variant variant;
+    variant.sourceFile = sourceFile;
+
+    size_t sourceBytes = 0;
+    std::uint64_t sourceStamp = 0;                       // Content hash if packed, else last write time
+    if (AssetArchive::View packed = AssetArchive::getInstance().find(sourceFile)) {
+        const auto* bytes = static_cast<const std::uint8_t*>(packed.data);
+        sourceBytes = packed.size;
+        sourceStamp = hashBytes(bytes, packed.size);
+        variant.sourceSize = readPngSize(bytes, packed.size);
+    }
+    else {
+        std::ifstream file(sourceFile, std::ios::binary | std::ios::ate);
+        if (file.is_open()) {
+            sourceBytes = static_cast<size_t>(file.tellg());
+            std::uint8_t header[PNG_HEADER_BYTES] = {};
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(header), sizeof(header));
+            variant.sourceSize = readPngSize(header, static_cast<size_t>(file.gcount()));
+            sourceStamp = lastWriteStamp(sourceFile);
+        }
+    }
+    variant.size = variant.sourceSize;
+
+    if (variant.sourceSize.x == 0 || variant.sourceSize.y == 0 || resolution.x == 0 || resolution.y == 0) {
+        return variant;
+    }
+
+    // Cover the screen in both directions, so stretched and height-fitted sprites never upscale
+    float factor = std::max(static_cast<float>(resolution.x) / variant.sourceSize.x,
+        static_cast<float>(resolution.y) / variant.sourceSize.y);
+    if (factor >= MIN_DOWNSCALE_FACTOR) {
+        return variant;
+    }
+
+    variant.size.x = std::max(1u, static_cast<unsigned>(std::ceil(variant.sourceSize.x * factor)));
+    variant.size.y = std::max(1u, static_cast<unsigned>(std::ceil(variant.sourceSize.y * factor)));
+    variant.cacheFile = VARIANT_CACHE_DIR + "/" + fileStem(sourceFile) + "_" +
+        std::to_string(variant.size.x) + "x" + std::to_string(variant.size.y) + "_" +
+        std::to_string(sourceBytes) + "_" + toHex(sourceStamp) + ".png";
+    return variant;
+}
+
+bool TextureVariantCache::loadImage(const Variant& variant, sf::Image& image) {
+    if (!variant.isScaled()) {
+        return loadSource(variant.sourceFile, image);
+    }
+
+    std::error_code error;
+    if (std::filesystem::exists(variant.cacheFile, error) &&
+        image.loadFromFile(variant.cacheFile) && image.getSize() == variant.size) {
+        return true;
+    }
+
+    sf::Image source;
+    if (!loadSource(variant.sourceFile, source)) {
+        return false;
+    }
+    image = downscale(source, variant.size);
+
+    // A failed write only costs the next run another downscale
+    std::filesystem::create_directories(VARIANT_CACHE_DIR, error);
+    if (error || !image.saveToFile(variant.cacheFile)) {
+        std::cerr << "Could not cache texture variant " << variant.cacheFile << std::endl;
+    }
+    return true;
+}
+
+std::string TextureVariantCache::textureName(const Variant& variant) {
+    if (!variant.isScaled()) {
+        return variant.sourceFile;
+    }
+    return variant.sourceFile + "@" + std::to_string(variant.size.x) + "x" + std::to_string(variant.size.y);
+}
+
+bool TextureVariantCache::loadSource(const std::string& sourceFile, sf::Image& image) {
+    if (AssetArchive::View packed = AssetArchive::getInstance().find(sourceFile)) {
+        return image.loadFromMemory(packed.data, packed.size);
+    }
+    return image.loadFromFile(sourceFile);
+}
+
+// Box filter: every destination pixel averages the source block it covers.
+// Colour is weighted by alpha so transparent pixels do not darken edges.
+sf::Image TextureVariantCache::downscale(const sf::Image& source, const sf::Vector2u& size) {
+    const sf::Vector2u sourceSize = source.getSize();
+    const std::uint8_t* in = source.getPixelsPtr();
+    std::vector<std::uint8_t> out(static_cast<size_t>(size.x) * size.y * 4);
+
+    for (unsigned y = 0; y < size.y; ++y) {
+        unsigned y0 = static_cast<unsigned>(static_cast<std::uint64_t>(y) * sourceSize.y / size.y);
+        unsigned y1 = std::max(y0 + 1, static_cast<unsigned>(static_cast<std::uint64_t>(y + 1) * sourceSize.y / size.y));
+
+        for (unsigned x = 0; x < size.x; ++x) {
+            unsigned x0 = static_cast<unsigned>(static_cast<std::uint64_t>(x) * sourceSize.x / size.x);
+            unsigned x1 = std::max(x0 + 1, static_cast<unsigned>(static_cast<std::uint64_t>(x + 1) * sourceSize.x / size.x));
+
+            std::uint64_t red = 0, green = 0, blue = 0, alpha = 0;
+            for (unsigned sy = y0; sy < y1; ++sy) {
+                const std::uint8_t* pixel = in + (static_cast<size_t>(sy) * sourceSize.x + x0) * 4;
+                for (unsigned sx = x0; sx < x1; ++sx, pixel += 4) {
+                    red += pixel[0] * pixel[3];
+                    green += pixel[1] * pixel[3];
+                    blue += pixel[2] * pixel[3];
+                    alpha += pixel[3];
+                }
+            }
+
+            const std::uint64_t count = static_cast<std::uint64_t>(x1 - x0) * (y1 - y0);
+            std::uint8_t* target = out.data() + (static_cast<size_t>(y) * size.x + x) * 4;
+            if (alpha > 0) {
+                target[0] = static_cast<std::uint8_t>((red + alpha / 2) / alpha);
+                target[1] = static_cast<std::uint8_t>((green + alpha / 2) / alpha);
+                target[2] = static_cast<std::uint8_t>((blue + alpha / 2) / alpha);
+            }
+            target[3] = static_cast<std::uint8_t>((alpha + count / 2) / count);
+        }
+    }
+
+    sf::Image image;
+    image.create(size.x, size.y, out.data());
+    return image;
+}
@@ -0,0 +1,187 @@
+// ================================
+// src/Managers/AsyncAssetLoader.cpp
+// ================================
+#include "Managers/AsyncAssetLoader.h"
+#include "Managers/ResourceManager.h"
+#include "Systems/EventSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+AsyncAssetLoader& AsyncAssetLoader::getInstance() {
+    static AsyncAssetLoader instance;
+    return instance;
+}
+
+AsyncAssetLoader::~AsyncAssetLoader() {
+    shutdown();
+}
+
+void AsyncAssetLoader::start(unsigned workerCount) {
+    if (!m_workers.empty()) return;
+
+    if (workerCount == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_stopping = false;
+    }
+    for (unsigned i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&AsyncAssetLoader::workerLoop, this);
+    }
+}
+
+void AsyncAssetLoader::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_stopping = true;
+        m_jobs.clear();
+    }
+    m_jobReady.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) worker.join();
+    }
+    m_workers.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(m_decodedMutex);
+        m_decoded.clear();
+    }
+    m_uploadQueue.clear();
+
+    // Nobody will fulfil these any more
+    for (auto& [name, request] : m_pending) {
+        request.promise.set_value(false);
+    }
+    m_pending.clear();
+    m_progress = Progress();
+}
+
+// Requests for a texture that is loaded or already queued share one future
+std::shared_future<bool> AsyncAssetLoader::loadTextureAsync(const std::string& name, const std::string& filename) {
+    TextureVariantCache::Variant variant;
+    variant.sourceFile = filename;
+    return enqueue(name, variant);
+}
+
+std::shared_future<bool> AsyncAssetLoader::loadTextureAsync(const TextureVariantCache::Variant& variant) {
+    return enqueue(TextureVariantCache::textureName(variant), variant);
+}
+
+std::shared_future<bool> AsyncAssetLoader::enqueue(const std::string& name, const TextureVariantCache::Variant& variant) {
+    auto existing = m_pending.find(name);
+    if (existing != m_pending.end()) {
+        return existing->second.future;
+    }
+
+    if (ResourceManager::getInstance().hasTexture(name)) {
+        std::promise<bool> ready;
+        ready.set_value(true);
+        return ready.get_future().share();
+    }
+
+    start();
+
+    PendingRequest& request = m_pending[name];
+    request.future = request.promise.get_future().share();
+    ++m_progress.requested;
+
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_jobs.push_back({ name, variant });
+    }
+    m_jobReady.notify_one();
+    return request.future;
+}
+
+void AsyncAssetLoader::workerLoop() {
+    for (;;) {
+        DecodeJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobReady.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping) return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        // PNG decode (and any first-run downscale) is the expensive part and needs no GL context
+        DecodedImage decoded;
+        decoded.name = std::move(job.name);
+        decoded.ok = TextureVariantCache::loadImage(job.variant, decoded.image);
+        if (!decoded.ok) {
+            EventSystem::getInstance().post<AssetLoadFailedEvent>("Could not decode " + job.variant.sourceFile);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_decodedMutex);
+            m_decoded.push_back(std::move(decoded));
+        }
+        m_decodedReady.notify_one();
+    }
+}
+
+// Upload decoded images until the budget runs out; at least one per call so loading always advances
+void AsyncAssetLoader::pump(float budgetMs) {
+    if (m_pending.empty()) {
+        m_progress = Progress();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_decodedMutex);
+        for (auto& decoded : m_decoded) {
+            m_uploadQueue.push_back(std::move(decoded));
+        }
+        m_decoded.clear();
+    }
+    if (m_uploadQueue.empty()) return;
+
+    auto start = std::chrono::steady_clock::now();
+    size_t uploaded = 0;
+    auto& resources = ResourceManager::getInstance();
+
+    while (uploaded < m_uploadQueue.size()) {
+        DecodedImage& decoded = m_uploadQueue[uploaded++];
+        // A synchronous getTexture may have loaded it meanwhile; sprites could already point at that one
+        bool ok = resources.hasTexture(decoded.name) ||
+            (decoded.ok && resources.loadTextureFromImage(decoded.name, decoded.image));
+        complete(decoded.name, ok);
+
+        float elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= budgetMs) break;
+    }
+    m_uploadQueue.erase(m_uploadQueue.begin(), m_uploadQueue.begin() + uploaded);
+
+    EventSystem::getInstance().publish<AssetLoadProgressEvent>(
+        static_cast<int>(m_progress.completed), static_cast<int>(m_progress.requested));
+}
+
+void AsyncAssetLoader::flush() {
+    while (!m_pending.empty()) {
+        {
+            std::unique_lock<std::mutex> lock(m_decodedMutex);
+            m_decodedReady.wait_for(lock, std::chrono::milliseconds(5),
+                [this]() { return !m_decoded.empty(); });
+        }
+        pump(1.0e9f);
+    }
+    m_progress = Progress();
+}
+
+void AsyncAssetLoader::complete(const std::string& name, bool ok) {
+    auto it = m_pending.find(name);
+    if (it == m_pending.end()) return;
+
+    if (!ok) {
+        ++m_progress.failed;
+        ResourceManager::getInstance().discardAtlasPage(name);
+    }
+    ++m_progress.completed;
+
+    it->second.promise.set_value(ok);
+    m_pending.erase(it);
+}
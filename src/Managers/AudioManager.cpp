@@ -3,8 +3,72 @@
 // ================================
 #include "Managers/AudioManager.h"
 #include "Managers/SettingsManager.h"
+#include "Utils/AssetArchive.h"
+#include "Utils/ConfigLoader.h"
 #include <iostream>
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+    const char* const SOUND_TABLE_FILE = "sounds.cfg";
+
+    struct BuiltinSound {
+        const char* name;
+        const char* file;
+    };
+
+    // Indexed by SoundId
+    const BuiltinSound BUILTIN_SOUNDS[] = {
+        // UI and game events
+        { "button_hover", "button_hover.wav" },
+        { "click", "click.wav" },
+        { "coin_added", "coin_added.wav" },
+        { "health_kit_added", "health_kit_added.wav" },
+        { "explosion", "explosion.wav" },
+        { "placed", "placed.wav" },
+        { "killed", "killed.wav" },
+        { "level_up", "level_up.wav" },
+        { "gameover", "gameover.wav" },
+        { "error", "error_action.wav" },
+        // Combat sounds
+        { "heavy_gunner_shot", "heavy_gunner_shot.wav" },
+        { "robot_bullet", "robot_bullet.wav" },
+        { "sniper_shot", "sniper_shot.wav" },
+        { "shield_barier_fight", "shield_barier_fight.wav" },
+        // Hit and damage sounds
+        { "stealth_robot_hit", "stealth_robot_hit.wav" },
+        { "rock_robot_hit", "rock_robot_hit.wav" },
+        // Death sounds
+        { "squad_died", "squad_died.wav" },
+        { "rock_robot_die", "rock_robot_die.wav" },
+        { "shield_died", "shield_died.wav" },
+        { "stealth_robot_die", "stealth_robot_die.wav" },
+        // UI sounds
+        { "more", "more.wav" }
+    };
+    static_assert(std::size(BUILTIN_SOUNDS) == assetIndex(SoundId::BuiltinCount),
+        "BUILTIN_SOUNDS must list every built-in SoundId in order");
+
+    // Fill the rule fields present in a sound table section, keeping the rest
+    void readSoundRule(const std::unordered_map<std::string, std::string>& values, AudioManager::SoundRule& rule) {
+        auto read = [&values](const char* key, auto& field) {
+            auto it = values.find(key);
+            if (it == values.end()) return;
+            try {
+                field = static_cast<std::decay_t<decltype(field)>>(std::stof(it->second));
+            }
+            catch (const std::exception&) {
+                std::cerr << "Invalid sound table value " << key << "=" << it->second << '\n';
+            }
+        };
+        read("maxInstances", rule.maxInstances);
+        read("retriggerInterval", rule.retriggerInterval);
+        read("mergeGain", rule.mergeGain);
+        read("maxVolume", rule.maxVolume);
+    }
+}
 
 // Singleton access point
 AudioManager& AudioManager::getInstance() {
@@ -12,42 +76,44 @@ AudioManager& AudioManager::getInstance() {
     return instance;
 }
 
+AudioManager::AudioManager() {
+    static_assert(VOICE_COUNT <= 256, "Voice indices are stored as uint8_t");
+    for (size_t i = 0; i < VOICE_COUNT; ++i) {
+        m_freeVoices[i] = static_cast<std::uint8_t>(VOICE_COUNT - 1 - i);
+    }
+    m_freeVoiceCount = VOICE_COUNT;
+
+    // Built-in ids are valid before their buffers load
+    for (const auto& sound : BUILTIN_SOUNDS) {
+        getSoundId(sound.name);
+    }
+}
+
 // Initialize audio system and load all sound assets
 void AudioManager::initialize() {
+    initialize(decodeBuiltinSounds());
+}
+
+// Only the buffer uploads and music opening happen here; startup decodes on a worker
+void AudioManager::initialize(std::vector<DecodedSound> sounds) {
     // Load settings from persistent storage
     m_settings = SettingsManager::getInstance().getCurrentSettings().audio;
     updateVolumes();  // Apply volume settings
 
+    // Limits first, so every loaded sound picks up its rule
+    loadSoundRules(SOUND_TABLE_FILE);
+
     // === Load Sound Effects (SFX) ===
-    loadSound("button_hover", "button_hover.wav");
-    loadSound("click", "click.wav");
-    loadSound("coin_added", "coin_added.wav");
-    loadSound("health_kit_added", "health_kit_added.wav");
-    loadSound("explosion", "explosion.wav");
-    loadSound("placed", "placed.wav");
-    loadSound("killed", "killed.wav");
-    loadSound("level_up", "level_up.wav");
-    loadSound("gameover", "gameover.wav");
-    loadSound("error", "error_action.wav");
-
-    // Combat sounds
-    loadSound("heavy_gunner_shot", "heavy_gunner_shot.wav");
-    loadSound("robot_bullet", "robot_bullet.wav");
-    loadSound("sniper_shot", "sniper_shot.wav");
-    loadSound("shield_barier_fight", "shield_barier_fight.wav");
-
-    // Hit and damage sounds
-    loadSound("stealth_robot_hit", "stealth_robot_hit.wav");
-    loadSound("rock_robot_hit", "rock_robot_hit.wav");
-
-    // Death sounds
-    loadSound("squad_died", "squad_died.wav");
-    loadSound("rock_robot_die", "rock_robot_die.wav");
-    loadSound("shield_died", "shield_died.wav");
-    loadSound("stealth_robot_die", "stealth_robot_die.wav");
-
-    // UI sounds
-    loadSound("more", "more.wav");
+    for (const auto& sound : sounds) {
+        auto buffer = std::make_unique<sf::SoundBuffer>();
+        if (!buffer->loadFromSamples(sound.samples.data(), sound.samples.size(), sound.channelCount, sound.sampleRate)) {
+            std::cerr << "Failed to load sound: " << sound.name << '\n';
+            continue;
+        }
+        SoundEntry& entry = m_sounds[assetIndex(getSoundId(sound.name))];
+        entry.buffer = std::move(buffer);
+        entry.rule = getSoundRule(sound.name);
+    }
 
     // === Load Background Music ===
     loadMusic("Menu", "menu_state.ogg");
@@ -60,26 +126,118 @@ void AudioManager::initialize() {
 void AudioManager::shutdown() {
     stopAllSounds();
     stopMusic();
-    m_soundBuffers.clear();
+    for (auto& entry : m_sounds) {
+        entry.buffer.reset();                // Ids stay valid for a later initialize()
+    }
     m_musicTracks.clear();
     m_currentMusic = nullptr;
 }
 
-// Load sound buffer from file
+std::vector<AudioManager::DecodedSound> AudioManager::decodeBuiltinSounds() {
+    std::vector<DecodedSound> sounds;
+    sounds.reserve(std::size(BUILTIN_SOUNDS));
+    for (const auto& builtin : BUILTIN_SOUNDS) {
+        DecodedSound sound;
+        if (decodeSound(builtin.file, sound)) {
+            sound.name = builtin.name;
+            sounds.push_back(std::move(sound));
+        }
+    }
+    return sounds;
+}
+
+bool AudioManager::decodeSound(const std::string& filename, DecodedSound& sound) {
+    sf::InputSoundFile file;
+    AssetArchive::View packed = AssetArchive::getInstance().find(filename);
+    bool opened = packed ? file.openFromMemory(packed.data, packed.size) : file.openFromFile(filename);
+    if (!opened) {
+        std::cerr << "Failed to load sound: " << filename << '\n';
+        return false;
+    }
+
+    sound.samples.resize(static_cast<size_t>(file.getSampleCount()));
+    sound.samples.resize(static_cast<size_t>(file.read(sound.samples.data(), sound.samples.size())));
+    sound.channelCount = file.getChannelCount();
+    sound.sampleRate = file.getSampleRate();
+    return true;
+}
+
+// Load sound buffer from the packed archive, falling back to the loose file
 bool AudioManager::loadSound(const std::string& name, const std::string& filename) {
     auto buffer = std::make_unique<sf::SoundBuffer>();
-    if (!buffer->loadFromFile(getFullPath(filename))) {
+    AssetArchive::View packed = AssetArchive::getInstance().find(filename);
+    bool loaded = packed ? buffer->loadFromMemory(packed.data, packed.size)
+                         : buffer->loadFromFile(getFullPath(filename));
+    if (!loaded) {
         std::cerr << "Failed to load sound: " << filename << '\n';
         return false;
     }
-    m_soundBuffers[name] = std::move(buffer);
+    SoundEntry& entry = m_sounds[assetIndex(getSoundId(name))];
+    entry.buffer = std::move(buffer);
+    entry.rule = getSoundRule(name);
     return true;
 }
 
-// Load music track from file
+// Names seen for the first time get the next free id, loaded or not
+SoundId AudioManager::getSoundId(const std::string& name) {
+    auto it = m_soundIds.find(name);
+    if (it != m_soundIds.end()) {
+        return it->second;
+    }
+
+    SoundId id = static_cast<SoundId>(m_sounds.size());
+    m_sounds.emplace_back();
+    m_sounds.back().name = name;
+    m_sounds.back().rule = getSoundRule(name);
+    m_soundIds.emplace(name, id);
+    return id;
+}
+
+// Sound table: [Default] plus one section per sound name; a missing table keeps the built-in default
+bool AudioManager::loadSoundRules(const std::string& filename) {
+    ConfigLoader::Sections sections;
+    if (!ConfigLoader::parseFile(filename, sections)) {
+        std::cerr << "Sound table not found: " << filename << '\n';
+        return false;
+    }
+
+    m_defaultRule = SoundRule{};
+    m_soundRules.clear();
+
+    auto defaults = sections.find("Default");
+    if (defaults != sections.end()) {
+        readSoundRule(defaults->second, m_defaultRule);
+    }
+    for (const auto& [name, values] : sections) {
+        if (name == "Default") continue;
+        SoundRule rule = m_defaultRule;
+        readSoundRule(values, rule);
+        m_soundRules[name] = rule;
+    }
+
+    for (auto& entry : m_sounds) {
+        entry.rule = getSoundRule(entry.name);
+    }
+    return true;
+}
+
+void AudioManager::setSoundRule(const std::string& name, const SoundRule& rule) {
+    m_soundRules[name] = rule;
+    m_sounds[assetIndex(getSoundId(name))].rule = rule;
+}
+
+AudioManager::SoundRule AudioManager::getSoundRule(const std::string& name) const {
+    auto it = m_soundRules.find(name);
+    return it != m_soundRules.end() ? it->second : m_defaultRule;
+}
+
+// Open music track; packed tracks stream straight out of the archive mapping
 bool AudioManager::loadMusic(const std::string& name, const std::string& filename) {
     auto music = std::make_unique<sf::Music>();
-    if (!music->openFromFile(getFullPath(filename))) {
+    AssetArchive::View packed = AssetArchive::getInstance().find(filename);
+    bool opened = packed ? music->openFromMemory(packed.data, packed.size)
+                         : music->openFromFile(getFullPath(filename));
+    if (!opened) {
         std::cerr << "Failed to load music: " << filename << '\n';
         return false;
     }
@@ -88,41 +246,72 @@ bool AudioManager::loadMusic(const std::string& name, const std::string& filenam
 }
 
 // Play sound with default SFX category
+void AudioManager::playSound(SoundId id, float volume) {
+    playSound(id, AudioCategory::SFX, volume);
+}
+
 void AudioManager::playSound(const std::string& name, float volume) {
-    playSound(name, AudioCategory::SFX, volume);
+    playSound(getSoundId(name), AudioCategory::SFX, volume);
 }
 
-// Play sound with specific category and volume
 void AudioManager::playSound(const std::string& name, AudioCategory category, float volume) {
+    playSound(getSoundId(name), category, volume);
+}
+
+// Play sound with specific category and volume
+void AudioManager::playSound(SoundId id, AudioCategory category, float volume) {
     // Check mute and category enable states
     if (m_settings.muted) return;
     if ((category == AudioCategory::SFX && !m_settings.sfxEnabled) ||
         (category == AudioCategory::Music && !m_settings.musicEnabled)) return;
 
     // Find sound buffer
-    auto it = m_soundBuffers.find(name);
-    if (it == m_soundBuffers.end()) return;
-
-    // Create and configure sound instance
-    auto sound = std::make_unique<sf::Sound>();
-    sound->setBuffer(*it->second);
-    sound->setVolume(computeFinalVolume(category, volume));
-    sound->play();
-
-    // Cleanup old sounds periodically for memory management
-    if (m_activeSounds.size() > 250) {
-        cleanupStoppedSounds();
-    }
-
-    // Add to active sounds list
-    m_activeSounds.push_back(std::move(sound));
+    if (assetIndex(id) >= m_sounds.size()) return;
+    SoundEntry& entry = m_sounds[assetIndex(id)];
+    if (!entry.buffer) return;
+
+    // A burst of the same sound becomes one louder voice
+    if (mergeTrigger(id, volume)) return;
+
+    // Reuse a preallocated voice; nothing is allocated per shot
+    Voice* voice = acquireVoice(category);
+    if (!voice) return;                      // Every voice is busy with something more important
+
+    entry.lastStartTime = m_clock.getElapsedTime().asSeconds();
+    ++entry.playingCount;
+    entry.newestVoice = static_cast<int>(voice - m_voices.data());
+    voice->soundId = id;
+    voice->category = category;
+    voice->volume = volume;
+    voice->startOrder = ++m_voiceStartCounter;
+    voice->sound.setBuffer(*entry.buffer);
+    voice->sound.setVolume(computeFinalVolume(category, volume));
+    voice->sound.play();
 }
 
 // Stop all currently playing sounds
 void AudioManager::stopAllSounds() {
-    for (auto& sound : m_activeSounds)
-        sound->stop();
-    m_activeSounds.clear();
+    for (auto& voice : m_voices) {
+        voice.sound.stop();
+        voice.claimed = false;
+        voice.soundId = SoundId::Invalid;
+    }
+    for (auto& entry : m_sounds) {
+        entry.playingCount = 0;
+        entry.newestVoice = -1;
+    }
+    for (size_t i = 0; i < VOICE_COUNT; ++i) {
+        m_freeVoices[i] = static_cast<std::uint8_t>(VOICE_COUNT - 1 - i);
+    }
+    m_freeVoiceCount = VOICE_COUNT;
+}
+
+void AudioManager::setCategoryPriority(AudioCategory category, int priority) {
+    m_categoryPriorities[static_cast<size_t>(category)] = priority;
+}
+
+int AudioManager::getCategoryPriority(AudioCategory category) const {
+    return m_categoryPriorities[static_cast<size_t>(category)];
 }
 
 // Play background music with looping option
@@ -181,10 +370,11 @@ void AudioManager::updateVolumes() {
     if (m_currentMusic)
         m_currentMusic->setVolume(m_settings.musicEnabled ? music * 100.0f : 0.0f);
 
-    // Update all active sound volumes
-    for (auto& sound : m_activeSounds) {
-        if (sound->getStatus() == sf::Sound::Playing) {
-            sound->setVolume(m_settings.sfxEnabled ? sfx * 100.0f : 0.0f);
+    // Update all playing voices, each by its own category
+    for (auto& voice : m_voices) {
+        if (voice.claimed && voice.sound.getStatus() == sf::Sound::Playing) {
+            bool enabled = voice.category != AudioCategory::SFX || m_settings.sfxEnabled;
+            voice.sound.setVolume(enabled ? computeFinalVolume(voice.category, voice.volume) : 0.0f);
         }
     }
 }
@@ -232,7 +422,7 @@ bool AudioManager::isMuted() const {
 
 // Per-frame update for cleanup
 void AudioManager::update(float) {
-    cleanupStoppedSounds();
+    reclaimFinishedVoices();
 }
 
 // Apply complete audio settings
@@ -248,14 +438,105 @@ AudioManager::AudioSettings AudioManager::getSettings() const {
 
 // Private Helper Methods
 
-// Remove stopped sounds from memory
-void AudioManager::cleanupStoppedSounds() {
-    m_activeSounds.erase(
-        std::remove_if(m_activeSounds.begin(), m_activeSounds.end(),
-            [](const std::unique_ptr<sf::Sound>& s) {
-                return s->getStatus() == sf::Sound::Stopped;
-            }),
-        m_activeSounds.end());
+// Pop the free list; when it is empty, steal the least important voice:
+// lowest priority, quietest, oldest. A voice of higher priority than the new
+// sound is never stolen. Voices that finished since the last update are
+// reclaimed there, so this never queries OpenAL per voice.
+AudioManager::Voice* AudioManager::acquireVoice(AudioCategory category) {
+    if (m_freeVoiceCount > 0) {
+        Voice& voice = m_voices[m_freeVoices[--m_freeVoiceCount]];
+        voice.claimed = true;
+        return &voice;
+    }
+
+    const int priority = getCategoryPriority(category);
+    Voice* victim = nullptr;
+    int victimPriority = 0;
+    float victimVolume = 0.0f;
+
+    for (auto& voice : m_voices) {
+        int voicePriority = getCategoryPriority(voice.category);
+        if (voicePriority > priority) continue;
+
+        float voiceVolume = computeFinalVolume(voice.category, voice.volume);
+        bool better = !victim || voicePriority < victimPriority ||
+            (voicePriority == victimPriority && (voiceVolume < victimVolume ||
+                (voiceVolume == victimVolume && voice.startOrder < victim->startOrder)));
+        if (better) {
+            victim = &voice;
+            victimPriority = voicePriority;
+            victimVolume = voiceVolume;
+        }
+    }
+
+    if (victim) {
+        victim->sound.stop();
+        releaseVoice(static_cast<size_t>(victim - m_voices.data()));
+    }
+    return victim;
+}
+
+// Over the instance limit or inside the retrigger interval, bump the newest
+// voice of this sound instead of starting another. With none playing (limit 0
+// or all finished) the trigger is dropped or starts normally. Counts are kept
+// per sound and refreshed once per update, so this is constant time.
+bool AudioManager::mergeTrigger(SoundId id, float volume) {
+    const SoundEntry& entry = m_sounds[assetIndex(id)];
+    Voice* newest = entry.newestVoice >= 0 ? &m_voices[entry.newestVoice] : nullptr;
+    const int playing = entry.playingCount;
+
+    const SoundRule& rule = entry.rule;
+    const float sinceStart = m_clock.getElapsedTime().asSeconds() - entry.lastStartTime;
+    const bool atLimit = playing >= rule.maxInstances;
+    const bool tooSoon = entry.lastStartTime >= 0.0f && sinceStart < rule.retriggerInterval;
+
+    if (!newest) {
+        return atLimit;                      // Nothing to merge into; a limit of 0 mutes the sound
+    }
+    if (!atLimit && !tooSoon) {
+        return false;
+    }
+
+    float merged = std::min(newest->volume + volume * rule.mergeGain, std::max(rule.maxVolume, newest->volume));
+    if (merged != newest->volume) {
+        newest->volume = merged;
+        bool enabled = newest->category != AudioCategory::SFX || m_settings.sfxEnabled;
+        newest->sound.setVolume(enabled ? computeFinalVolume(newest->category, merged) : 0.0f);
+    }
+    return true;
+}
+
+void AudioManager::reclaimFinishedVoices() {
+    for (size_t i = 0; i < VOICE_COUNT; ++i) {
+        Voice& voice = m_voices[i];
+        if (voice.claimed && voice.sound.getStatus() == sf::Sound::Stopped) {
+            releaseVoice(i);
+            voice.claimed = false;
+            m_freeVoices[m_freeVoiceCount++] = static_cast<std::uint8_t>(i);
+        }
+    }
+}
+
+// Releasing the newest voice of a sound falls back to its next newest; this
+// only reads the voice table, never the OpenAL sources
+void AudioManager::releaseVoice(size_t index) {
+    Voice& voice = m_voices[index];
+    if (voice.soundId == SoundId::Invalid) return;
+
+    const SoundId id = voice.soundId;
+    SoundEntry& entry = m_sounds[assetIndex(id)];
+    voice.soundId = SoundId::Invalid;
+    --entry.playingCount;
+
+    if (entry.newestVoice == static_cast<int>(index)) {
+        entry.newestVoice = -1;
+        for (size_t i = 0; i < VOICE_COUNT; ++i) {
+            if (m_voices[i].soundId != id) continue;
+            if (entry.newestVoice < 0 || m_voices[i].startOrder > m_voices[entry.newestVoice].startOrder) {
+                entry.newestVoice = static_cast<int>(i);
+            }
+        }
+    }
 }
 
 // Calculate final volume considering category and master volume
@@ -266,6 +547,16 @@ float AudioManager::computeFinalVolume(AudioCategory category, float volume) con
     return volume * (catVolume / 100.f) * (m_settings.masterVolume / 100.f);
 }
 
+// Decoded 16-bit samples; music is streamed and holds no buffer of its own
+size_t AudioManager::getSoundMemoryUsage() const {
+    size_t bytes = 0;
+    for (const auto& entry : m_sounds) {
+        if (!entry.buffer) continue;
+        bytes += static_cast<size_t>(entry.buffer->getSampleCount()) * sizeof(std::int16_t);
+    }
+    return bytes;
+}
+
 // Get full file path for audio files
 std::string AudioManager::getFullPath(const std::string& filename) const {
     return filename; // Files are in working directory
@@ -0,0 +1,126 @@
+// ================================
+// src/Managers/HotReloadManager.cpp
+// ================================
+#include "Managers/HotReloadManager.h"
+#include "Managers/ResourceManager.h"
+#include "Factories/RobotFactory.h"
+#include "Factories/SquadMemberFactory.h"
+#include "Systems/EventSystem.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+
+namespace {
+    // Settings.cfg is written by the game itself; physics.cfg and animations.cfg
+    // are baked into the world and clip tables at startup
+    const std::vector<std::string> RELOADABLE_CONFIGS = {
+        "game.cfg", "robots.cfg", "units.cfg", "projectiles.cfg", "collectibles.cfg"
+    };
+
+    const std::vector<std::string> IMAGE_EXTENSIONS = { ".png", ".jpg", ".jpeg", ".bmp" };
+
+    std::string lowerExtension(const std::filesystem::path& path) {
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+
+    bool contains(const std::vector<std::string>& list, const std::string& value) {
+        return std::find(list.begin(), list.end(), value) != list.end();
+    }
+}
+
+HotReloadManager& HotReloadManager::getInstance() {
+    static HotReloadManager instance;
+    return instance;
+}
+
+HotReloadManager::~HotReloadManager() {
+    stop();
+}
+
+bool HotReloadManager::start(const std::string& directory) {
+    bool started = m_watcher.start({ directory }, [this](const std::filesystem::path& path) {
+        onFileChanged(path);
+        });
+
+    if (started) {
+        std::cout << "Hot reload watching " << directory << std::endl;
+    }
+    return started;
+}
+
+void HotReloadManager::stop() {
+    m_watcher.stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_configUpdates.clear();
+    m_textureUpdates.clear();
+}
+
+// Parsing and decoding happen here so applyPending() only swaps data in
+void HotReloadManager::onFileChanged(const std::filesystem::path& path) {
+    const std::string filename = path.filename().string();
+    const std::string extension = lowerExtension(path);
+
+    if (extension == ".cfg") {
+        if (!contains(RELOADABLE_CONFIGS, filename)) return;
+
+        ConfigUpdate update;
+        update.filename = filename;
+        if (!ConfigLoader::parseFile(path.string(), update.sections)) {
+            std::cerr << "Hot reload: could not read " << filename << std::endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_configUpdates.push_back(std::move(update));
+    }
+    else if (contains(IMAGE_EXTENSIONS, extension)) {
+        // Always the loose file, even when assets.pak holds an older copy
+        TextureUpdate update;
+        update.name = filename;
+        if (!update.image.loadFromFile(path.string())) {
+            std::cerr << "Hot reload: could not decode " << filename << std::endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_textureUpdates.push_back(std::move(update));
+    }
+}
+
+void HotReloadManager::applyPending() {
+    std::vector<ConfigUpdate> configUpdates;
+    std::vector<TextureUpdate> textureUpdates;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        configUpdates.swap(m_configUpdates);
+        textureUpdates.swap(m_textureUpdates);
+    }
+
+    if (!configUpdates.empty()) {
+        auto& config = ConfigLoader::getInstance();
+        for (const auto& update : configUpdates) {
+            config.mergeSections(update.sections);
+        }
+
+        // Factories cache per-type configs for new spawns
+        RobotFactory::getInstance().reloadConfigurations();
+        SquadMemberFactory::getInstance().reloadConfigurations();
+
+        auto& events = EventSystem::getInstance();
+        for (const auto& update : configUpdates) {
+            std::cout << "Hot reload: " << update.filename << std::endl;
+            events.publish<ConfigReloadedEvent>(update.filename);
+        }
+    }
+
+    auto& resources = ResourceManager::getInstance();
+    for (const auto& update : textureUpdates) {
+        if (resources.reloadTexture(update.name, update.image)) {
+            std::cout << "Hot reload: " << update.name << std::endl;
+        }
+    }
+}
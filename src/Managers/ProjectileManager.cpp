@@ -44,7 +44,7 @@ void ProjectileManager::update(float dt) {
 }
 
 // Render all active projectiles
-void ProjectileManager::draw(sf::RenderWindow& window) const {
+void ProjectileManager::draw(sf::RenderTarget& window) const {
     for (const auto& projectile : m_entities) {
         if (projectile && projectile->isActive()) {
             projectile->draw(window);
@@ -159,20 +159,9 @@ int ProjectileManager::getProjectileCount() const {
 
 // Private Helper Methods
 
-// Get projectile damage from configuration files
+// Get projectile damage from the compiled projectile archetype
 int ProjectileManager::getProjectileDamageFromConfig(GameTypes::ProjectileType type) const {
-    auto& config = ConfigLoader::getInstance();
-
-    switch (type) {
-    case GameTypes::ProjectileType::Bullet:
-        return config.getInt("SquadBullet", "damage", 30);
-    case GameTypes::ProjectileType::SniperBullet:
-        return config.getInt("SniperBullet", "damage", 40);
-    case GameTypes::ProjectileType::RobotBullet:
-        return config.getInt("RobotBullet", "damage", 35);
-    default:
-        return 25;  // Default damage fallback
-    }
+    return ConfigLoader::getInstance().getProjectileArchetype(type).damage;
 }
 
 // Determine projectile type based on squad member type
@@ -189,42 +178,9 @@ GameTypes::ProjectileType ProjectileManager::getProjectileTypeForSquadMember(Gam
     }
 }
 
-// Get spawn offset for projectile based on type (from config)
+// Get spawn offset for projectile based on type (parsed once at config load)
 sf::Vector2f ProjectileManager::getSpawnOffsetForProjectile(GameTypes::ProjectileType type) const {
-    auto& config = ConfigLoader::getInstance();
-    std::string sectionName;
-
-    // Determine config section based on projectile type
-    switch (type) {
-    case GameTypes::ProjectileType::Bullet:
-        sectionName = "SquadBullet";
-        break;
-    case GameTypes::ProjectileType::RobotBullet:
-        sectionName = "RobotBullet";
-        break;
-    case GameTypes::ProjectileType::SniperBullet:
-        sectionName = "SniperBullet";
-        break;
-    default:
-        return sf::Vector2f(25.0f, 0.0f);  // Default offset
-    }
-
-    // Parse spawn offset from config string (format: "x,y")
-    std::string offsetStr = config.getString(sectionName, "spawnOffset", "25,0");
-    sf::Vector2f spawnOffset(25.0f, 0.0f);
-
-    size_t comma = offsetStr.find(',');
-    if (comma != std::string::npos) {
-        try {
-            spawnOffset.x = std::stof(offsetStr.substr(0, comma));
-            spawnOffset.y = std::stof(offsetStr.substr(comma + 1));
-        }
-        catch (const std::exception&) {
-            // Use default offset on parse error
-        }
-    }
-
-    return spawnOffset;
+    return ConfigLoader::getInstance().getProjectileArchetype(type).spawnOffset;
 }
 
 // Cleanup expired projectiles for memory management
@@ -2,6 +2,93 @@
 // Resource Manager - Singleton Pattern for Centralized Asset Loading and Caching
 // ================================
 #include "Managers/ResourceManager.h"
+#include "Managers/AsyncAssetLoader.h"
+#include "Managers/AudioManager.h"
+#include "Managers/SettingsManager.h"
+#include "Utils/AssetArchive.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <iostream>
+
+namespace {
+    const std::string ANIMATION_ATLAS_FILE = "animations.atlas";
+    const std::string GAME_FONT_NAME = "bruce";
+    const std::string GAME_FONT_FILE = "BruceForeverRegular-X3jd2.ttf";
+    const std::string UI_FONT_FILE = "DejaVuSans.ttf";
+
+    // Indexed by TextureId
+    const char* const BUILTIN_TEXTURES[] = {
+        "bullet.png", "SniperBullet.png", "robot_bullet.png", "bomb.png",
+        "placing_slot.png", "btn.png", "slider_knob.png", "select-b.png"
+    };
+    static_assert(std::size(BUILTIN_TEXTURES) == assetIndex(TextureId::BuiltinCount),
+        "BUILTIN_TEXTURES must list every built-in TextureId in order");
+
+    const std::vector<std::string> MENU_TEXTURES = {
+        // Background textures
+        "level_btn.png",
+        // Unit selection icons: HeavyGunner, Sniper, ShieldBearer, HealthPack, Bomb
+        "select1.png", "select2.png", "select3.png", "select_medkit.png", "select-b.png",
+        // UI elements
+        "slider_knob.png", "HealthPack.png", "Sniper_locked.png", "back_to_menu.png", "select_level.png",
+        // Command icons
+        "undo.png", "redo.png"
+    };
+
+    const std::vector<std::string> GAME_TEXTURES = {
+        // Placement grid
+        "placing_slot.png",
+        // Projectile textures
+        "bullet.png", "SniperBullet.png", "robot_bullet.png",
+        // Game objects
+        "bomb.png"
+    };
+
+    // Full-screen backgrounds, loaded through acquireScaledTexture
+    const std::vector<std::string> SCALED_TEXTURES = {
+        "menu_background.png", "level_bg.png",
+        // Level selection backgrounds (stitched together)
+        "levelbackground_left.png", "levelbackground_middle.png", "levelbackground_right.png"
+    };
+
+    // Sheets below are skipped when the packed atlas provides them
+    const std::vector<std::string> GAME_SHEETS = { "coin.png", "HealthBag.png" };
+
+    const std::vector<std::string> ANIMATION_SHEETS = {
+        // Effect animations
+        "explosion.png",
+        // Squad members: Heavy Gunner, Sniper, Shield Bearer
+        "HeavyGunner_Idle.png", "HeavyGunner_Shot.png", "HeavyGunner_Dead.png",
+        "ss_Idle.png", "Sniper_Shot.png", "Sniper_Dead.png",
+        "ShieldBearer_Idle.png", "ShieldBearer_Block.png", "ShieldBearer_Dead.png",
+        // Robots: Stealth, Fire, Basic (Rock Robot)
+        "StealthRobot_Walk1.png", "StealthRobot_Hit.png", "StealthRobot_Dead.png",
+        "fire_robot_walk.png", "fire_robot_death.png",
+        "RockRobot_Walk.png", "RobotRock_Dead.png", "RockRobot_Hit.png"
+    };
+
+    size_t fileSize(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        return file.is_open() ? static_cast<size_t>(file.tellg()) : 0;
+    }
+
+    std::string trimAtlasLine(const std::string& str) {
+        size_t first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+        size_t last = str.find_last_not_of(" \t\r\n");
+        return str.substr(first, last - first + 1);
+    }
+
+    // Parse "x,y,w,h"
+    bool parseAtlasRect(const std::string& value, sf::IntRect& rect) {
+        std::stringstream ss(value);
+        char c1 = 0, c2 = 0, c3 = 0;
+        ss >> rect.left >> c1 >> rect.top >> c2 >> rect.width >> c3 >> rect.height;
+        return !ss.fail() && c1 == ',' && c2 == ',' && c3 == ',';
+    }
+}
 
 // Singleton access point
 ResourceManager& ResourceManager::getInstance() {
@@ -9,20 +96,161 @@ ResourceManager& ResourceManager::getInstance() {
     return instance;
 }
 
-// Get texture with automatic loading if not cached
+// Built-in ids in AssetIds.h order
+ResourceManager::ResourceManager() {
+    for (const char* texture : BUILTIN_TEXTURES) {
+        getTextureId(texture);
+    }
+    registerFont(GAME_FONT_NAME, GAME_FONT_FILE);   // FontId::Game
+    registerFont(UI_FONT_FILE, UI_FONT_FILE);       // FontId::Ui
+}
+
+// Get texture with automatic loading if not cached; the reference pins it in memory
 sf::Texture& ResourceManager::getTexture(const std::string& filename) {
-    if (!hasTexture(filename)) {
-        loadTexture(filename, filename);
+    if (!hasTexture(filename) && !loadTexture(filename, filename)) {
+        return m_emptyTexture;     // Callers expect a texture; not cached, so the next call retries
+    }
+    CachedTexture& cached = m_textures[filename];
+    cached.lastUse = ++m_useClock;
+    cached.borrowed = true;
+    return *cached.texture;
+}
+
+// Get shared texture handle with automatic loading if not cached
+TextureHandle ResourceManager::acquireTexture(const std::string& filename) {
+    if (!hasTexture(filename) && !loadTexture(filename, filename)) {
+        return TextureHandle();
+    }
+    CachedTexture& cached = m_textures[filename];
+    cached.lastUse = ++m_useClock;
+    return TextureHandle(cached.texture);
+}
+
+// Get the variant of a full-screen texture that matches the active resolution,
+// generating and caching it on disk the first time
+TextureHandle ResourceManager::acquireScaledTexture(const std::string& filename) {
+    const TextureVariantCache::Variant& variant = selectVariant(filename);
+    const std::string name = TextureVariantCache::textureName(variant);
+
+    if (!hasTexture(name)) {
+        sf::Image image;
+        if (!TextureVariantCache::loadImage(variant, image) || !loadTextureFromImage(name, image)) {
+            std::cerr << "Failed to load texture: " << filename << std::endl;
+            return TextureHandle();
+        }
+    }
+    CachedTexture& cached = m_textures[name];
+    cached.lastUse = ++m_useClock;
+    return TextureHandle(cached.texture);
+}
+
+// Layouts authored against the original image use this instead of the texture size
+sf::Vector2u ResourceManager::getSourceSize(const std::string& filename) {
+    const TextureVariantCache::Variant& variant = selectVariant(filename);
+    if (variant.sourceSize.x > 0 && variant.sourceSize.y > 0) {
+        return variant.sourceSize;
+    }
+    auto it = m_textures.find(filename);
+    return (it != m_textures.end()) ? it->second.texture->getSize() : sf::Vector2u(0, 0);
+}
+
+// Variants are picked once per resolution; a resolution change picks again
+const TextureVariantCache::Variant& ResourceManager::selectVariant(const std::string& filename) {
+    sf::Vector2u resolution = SettingsManager::getInstance().getResolution();
+    if (resolution != m_variantResolution) {
+        m_variants.clear();
+        m_variantResolution = resolution;
     }
-    return *m_textures[filename];
+
+    auto it = m_variants.find(filename);
+    if (it == m_variants.end()) {
+        it = m_variants.emplace(filename, TextureVariantCache::select(filename, resolution)).first;
+    }
+    return it->second;
 }
 
 // Get font with automatic loading if not cached
 sf::Font& ResourceManager::getFont(const std::string& filename) {
-    if (!hasFont(filename)) {
-        loadFont(filename, filename);
+    if (!hasFont(filename) && !loadFont(filename, filename)) {
+        m_fonts[filename].font = std::make_shared<sf::Font>();
+    }
+    return *m_fonts[filename].font;
+}
+
+// Names seen for the first time get the next free id, loaded or not
+TextureId ResourceManager::getTextureId(const std::string& filename) {
+    auto it = m_textureIds.find(filename);
+    if (it != m_textureIds.end()) {
+        return it->second;
     }
-    return *m_fonts[filename];
+
+    TextureId id = static_cast<TextureId>(m_textureSlots.size());
+    m_textureSlots.push_back({ filename, nullptr });
+    m_textureIds.emplace(filename, id);
+    return id;
+}
+
+FontId ResourceManager::getFontId(const std::string& name) {
+    return registerFont(name, name);
+}
+
+FontId ResourceManager::registerFont(const std::string& name, const std::string& file) {
+    auto it = m_fontIds.find(name);
+    if (it != m_fontIds.end()) {
+        return it->second;
+    }
+
+    FontId id = static_cast<FontId>(m_fontSlots.size());
+    m_fontSlots.push_back({ name, file, nullptr });
+    m_fontIds.emplace(name, id);
+    return id;
+}
+
+// Same pinning as the name lookup; only the first call after a load hashes the name.
+// Invalid ids (e.g. an empty texture= in a config) get an empty texture, like a failed load
+sf::Texture& ResourceManager::getTexture(TextureId id) {
+    if (assetIndex(id) >= m_textureSlots.size()) {
+        return m_emptyTexture;
+    }
+    TextureSlot& slot = m_textureSlots[assetIndex(id)];
+    if (!slot.cached) {
+        sf::Texture& texture = getTexture(slot.name);
+        auto it = m_textures.find(slot.name);
+        if (it != m_textures.end()) {
+            slot.cached = &it->second;     // Stays unset after a failed load, so it is retried
+        }
+        return texture;
+    }
+    slot.cached->lastUse = ++m_useClock;
+    slot.cached->borrowed = true;
+    return *slot.cached->texture;
+}
+
+TextureHandle ResourceManager::acquireTexture(TextureId id) {
+    if (assetIndex(id) >= m_textureSlots.size()) {
+        return TextureHandle();
+    }
+    TextureSlot& slot = m_textureSlots[assetIndex(id)];
+    if (!slot.cached) {
+        TextureHandle handle = acquireTexture(slot.name);
+        if (handle) {
+            slot.cached = &m_textures[slot.name];
+        }
+        return handle;
+    }
+    slot.cached->lastUse = ++m_useClock;
+    return TextureHandle(slot.cached->texture);
+}
+
+sf::Font& ResourceManager::getFont(FontId id) {
+    FontSlot& slot = m_fontSlots.at(assetIndex(id));
+    if (!slot.cached) {
+        if (!hasFont(slot.name) && !loadFont(slot.name, slot.file)) {
+            m_fonts[slot.name].font = std::make_shared<sf::Font>();
+        }
+        slot.cached = &m_fonts[slot.name];
+    }
+    return *slot.cached->font;
 }
 
 // Check if texture is already loaded
@@ -37,131 +265,350 @@ bool ResourceManager::hasFont(const std::string& name) const {
 
 // Unload specific texture to free memory
 void ResourceManager::unloadTexture(const std::string& name) {
-    m_textures.erase(name);
+    auto it = m_textures.find(name);
+    if (it == m_textures.end()) return;
+    m_textureBytes -= it->second.bytes;
+    clearTextureSlot(name);
+    m_textures.erase(it);
+}
+
+void ResourceManager::clearTextureSlot(const std::string& name) {
+    auto id = m_textureIds.find(name);
+    if (id != m_textureIds.end()) {
+        m_textureSlots[assetIndex(id->second)].cached = nullptr;
+    }
 }
 
 // Unload specific font to free memory
 void ResourceManager::unloadFont(const std::string& name) {
+    auto id = m_fontIds.find(name);
+    if (id != m_fontIds.end()) {
+        m_fontSlots[assetIndex(id->second)].cached = nullptr;
+    }
     m_fonts.erase(name);
 }
 
 // Unload all resources for cleanup
 void ResourceManager::unloadAll() {
+    for (auto& slot : m_textureSlots) slot.cached = nullptr;
+    for (auto& slot : m_fontSlots) slot.cached = nullptr;
     m_textures.clear();
     m_fonts.clear();
+    m_atlasRegions.clear();
+    m_textureBytes = 0;
 }
 
-// Load texture atlas for sprite sheets
-void ResourceManager::loadTextureAtlas(const std::string& atlasName, const std::string& filename) {
-    loadTexture(atlasName, filename);
+// Evict unreferenced textures, least recently used first, until under budget
+size_t ResourceManager::enforceMemoryBudget() {
+    if (m_memoryBudget == 0 || m_textureBytes <= m_memoryBudget) return 0;
+
+    std::vector<std::pair<std::uint64_t, std::string>> candidates;
+    for (const auto& [name, cached] : m_textures) {
+        if (!cached.borrowed && cached.texture.use_count() == 1) {
+            candidates.emplace_back(cached.lastUse, name);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    size_t evicted = 0;
+    for (const auto& [lastUse, name] : candidates) {
+        if (m_textureBytes <= m_memoryBudget) break;
+        evicted += getTextureBytes(name);
+        unloadTexture(name);
+    }
+
+    if (m_textureBytes > m_memoryBudget) {
+        std::cerr << "Texture memory " << m_textureBytes / 1024 << " KB still above budget of "
+            << m_memoryBudget / 1024 << " KB; the rest is referenced" << std::endl;
+    }
+    return evicted;
+}
+
+// Parse atlas metadata produced by the AtlasPacker tool; region pages are still page indices
+bool ResourceManager::parseTextureAtlas(const std::string& filename, std::vector<std::string>& pages,
+    std::unordered_map<std::string, AtlasRegion>& regions) const {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string section;
+    std::string line;
+
+    while (std::getline(file, line)) {
+        line = trimAtlasLine(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        if (line.front() == '[' && line.back() == ']') {
+            section = line.substr(1, line.size() - 2);
+            continue;
+        }
+
+        size_t equalPos = line.find('=');
+        if (equalPos == std::string::npos) continue;
+
+        std::string key = line.substr(0, equalPos);
+        std::string value = line.substr(equalPos + 1);
+
+        try {
+            if (section == "pages") {
+                if (key.rfind("page", 0) == 0) {
+                    size_t index = std::stoul(key.substr(4));
+                    if (pages.size() <= index) pages.resize(index + 1);
+                    pages[index] = value;
+                }
+                continue;
+            }
+
+            AtlasRegion& region = regions[section];
+            if (key == "page") {
+                region.pageTexture = value;   // Resolved to a file name in commitAtlasRegions
+            }
+            else if (key == "bounds") {
+                parseAtlasRect(value, region.bounds);
+            }
+            else if (key.rfind("frame", 0) == 0 && key != "frames") {
+                size_t index = std::stoul(key.substr(5));
+                if (region.frames.size() <= index) region.frames.resize(index + 1);
+                if (!parseAtlasRect(value, region.frames[index])) {
+                    std::cerr << "Bad frame rect in " << filename << ": " << section << "." << key << std::endl;
+                    return false;
+                }
+            }
+        }
+        catch (const std::exception&) {
+            std::cerr << "Bad atlas entry in " << filename << ": " << line << std::endl;
+            return false;
+        }
+    }
+
+    for (const auto& page : pages) {
+        if (page.empty()) {
+            std::cerr << "Atlas " << filename << " has a missing page entry" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+void ResourceManager::commitAtlasRegions(const std::vector<std::string>& pages,
+    std::unordered_map<std::string, AtlasRegion>& regions) {
+    for (auto& [name, region] : regions) {
+        try {
+            size_t pageIndex = std::stoul(region.pageTexture);
+            if (pageIndex >= pages.size() || region.frames.empty()) continue;
+            region.pageTexture = pages[pageIndex];
+            m_atlasRegions[name] = std::move(region);
+        }
+        catch (const std::exception&) {
+            continue;
+        }
+    }
+}
+
+// Load packed atlas pages and frame rects produced by the AtlasPacker tool
+bool ResourceManager::loadTextureAtlas(const std::string& filename) {
+    std::vector<std::string> pages;
+    std::unordered_map<std::string, AtlasRegion> regions;
+    if (!parseTextureAtlas(filename, pages, regions)) {
+        return false;
+    }
+
+    // Upload pages, then commit regions only if every page loaded
+    for (const auto& page : pages) {
+        if (!hasTexture(page) && !loadTexture(page, page)) {
+            std::cerr << "Failed to load atlas page: " << page << std::endl;
+            return false;
+        }
+    }
+
+    commitAtlasRegions(pages, regions);
+    return true;
+}
+
+// Regions are usable immediately; pages arrive through the async loader and
+// discardAtlasPage() withdraws the regions of any page that fails
+bool ResourceManager::loadTextureAtlasAsync(const std::string& filename) {
+    std::vector<std::string> pages;
+    std::unordered_map<std::string, AtlasRegion> regions;
+    if (!parseTextureAtlas(filename, pages, regions)) {
+        return false;
+    }
+
+    commitAtlasRegions(pages, regions);
+
+    auto& loader = AsyncAssetLoader::getInstance();
+    for (const auto& page : pages) {
+        loader.loadTextureAsync(page, page);
+    }
+    return true;
+}
+
+void ResourceManager::discardAtlasPage(const std::string& page) {
+    for (auto it = m_atlasRegions.begin(); it != m_atlasRegions.end(); ) {
+        if (it->second.pageTexture == page) {
+            std::cerr << "Atlas page " << page << " unavailable, " << it->first << " falls back to its sheet" << std::endl;
+            it = m_atlasRegions.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+bool ResourceManager::hasAtlasRegion(const std::string& name) const {
+    return m_atlasRegions.find(name) != m_atlasRegions.end();
+}
+
+const AtlasRegion* ResourceManager::getAtlasRegion(const std::string& name) const {
+    auto it = m_atlasRegions.find(name);
+    return (it != m_atlasRegions.end()) ? &it->second : nullptr;
+}
+
+// Load a loose sprite sheet only when the packed atlas does not already contain it
+void ResourceManager::loadSheet(const std::string& filename) {
+    if (!hasAtlasRegion(filename)) {
+        loadTexture(filename, filename);
+    }
 }
 
 // Preload all menu-related assets for smooth UI
 void ResourceManager::preloadMenuAssets() {
-    // Background textures
-    loadTexture("menu_background.png", "menu_background.png");
-    loadTexture("level_btn.png", "level_btn.png");
-
-    // Level selection backgrounds (stitched together)
-    loadTexture("levelbackground_left.png", "levelbackground_left.png");
-    loadTexture("levelbackground_middle.png", "levelbackground_middle.png");
-    loadTexture("levelbackground_right.png", "levelbackground_right.png");
-
-    // Unit selection icons
-    loadTexture("select1.png", "select1.png");           // HeavyGunner
-    loadTexture("select2.png", "select2.png");           // Sniper
-    loadTexture("select3.png", "select3.png");           // ShieldBearer
-    loadTexture("select_medkit.png", "select_medkit.png"); // HealthPack
-    loadTexture("select-b.png", "select-b.png");         // Bomb
-
-    // UI elements
-    loadTexture("slider_knob.png", "slider_knob.png");
-    loadTexture("HealthPack.png", "HealthPack.png");
-    loadTexture("Sniper_locked.png", "Sniper_locked.png");
-    loadTexture("back_to_menu.png", "back_to_menu.png");
-    loadTexture("select_level.png", "select_level.png");
-
-    // Command icons
-    loadTexture("undo.png", "undo.png");
-    loadTexture("redo.png", "redo.png");
+    for (const auto& texture : MENU_TEXTURES) {
+        loadTexture(texture, texture);
+    }
+    for (const auto& texture : SCALED_TEXTURES) {
+        acquireScaledTexture(texture);
+    }
 }
 
 // Preload all gameplay assets
 void ResourceManager::preloadGameAssets() {
-    // Level background and grid
-    loadTexture("level_bg.png", "level_bg.png");
-    loadTexture("placing_slot.png", "placing_slot.png");
-
-    // Projectile textures
-    loadTexture("bullet.png", "bullet.png");
-    loadTexture("SniperBullet.png", "SniperBullet.png");
-    loadTexture("robot_bullet.png", "robot_bullet.png");
+    // Load animation assets first so the packed atlas covers the sheets below
+    preloadAnimationAssets();
 
-    // Game objects
-    loadTexture("bomb.png", "bomb.png");
-    loadTexture("coin.png", "coin.png");
-    loadTexture("HealthBag.png", "HealthBag.png");
+    for (const auto& texture : GAME_TEXTURES) {
+        loadTexture(texture, texture);
+    }
+    for (const auto& sheet : GAME_SHEETS) {
+        loadSheet(sheet);
+    }
 
     // Load primary game font
-    loadFont("bruce", "BruceForeverRegular-X3jd2.ttf");
-
-    // Load animation assets
-    preloadAnimationAssets();
+    loadFont(GAME_FONT_NAME, GAME_FONT_FILE);
 }
 
 // Preload all animation sprite sheets
 void ResourceManager::preloadAnimationAssets() {
-    // Effect animations
-    loadTexture("explosion.png", "explosion.png");
-
-    // Squad member animations
-    // Heavy Gunner
-    loadTexture("HeavyGunner_Idle.png", "HeavyGunner_Idle.png");
-    loadTexture("HeavyGunner_Shot.png", "HeavyGunner_Shot.png");
-    loadTexture("HeavyGunner_Dead.png", "HeavyGunner_Dead.png");
+    // Packed atlas (built by the AtlasPacker target) replaces the loose sheets
+    if (m_atlasRegions.empty()) {
+        loadTextureAtlas(ANIMATION_ATLAS_FILE);
+    }
 
-    // Sniper
-    loadTexture("ss_Idle.png", "ss_Idle.png");
-    loadTexture("Sniper_Shot.png", "Sniper_Shot.png");
-    loadTexture("Sniper_Dead.png", "Sniper_Dead.png");
+    for (const auto& sheet : ANIMATION_SHEETS) {
+        loadSheet(sheet);
+    }
+}
 
-    // Shield Bearer
-    loadTexture("ShieldBearer_Idle.png", "ShieldBearer_Idle.png");
-    loadTexture("ShieldBearer_Block.png", "ShieldBearer_Block.png");
-    loadTexture("ShieldBearer_Dead.png", "ShieldBearer_Dead.png");
+// Queue every startup texture for parallel decode; AsyncAssetLoader::pump uploads them
+void ResourceManager::preloadAllAssetsAsync() {
+    auto& loader = AsyncAssetLoader::getInstance();
 
-    // Robot animations
-    // Stealth Robot
-    loadTexture("StealthRobot_Walk1.png", "StealthRobot_Walk1.png");
-    loadTexture("StealthRobot_Hit.png", "StealthRobot_Hit.png");
-    loadTexture("StealthRobot_Dead.png", "StealthRobot_Dead.png");
+    // Atlas metadata first so the loose sheets it covers are never decoded
+    if (m_atlasRegions.empty()) {
+        loadTextureAtlasAsync(ANIMATION_ATLAS_FILE);
+    }
 
-    // Fire Robot
-    loadTexture("fire_robot_walk.png", "fire_robot_walk.png");
-    loadTexture("fire_robot_death.png", "fire_robot_death.png");
+    for (const auto* list : { &MENU_TEXTURES, &GAME_TEXTURES }) {
+        for (const auto& texture : *list) {
+            loader.loadTextureAsync(texture, texture);
+        }
+    }
+    for (const auto& texture : SCALED_TEXTURES) {
+        loader.loadTextureAsync(selectVariant(texture));
+    }
+    for (const auto* list : { &GAME_SHEETS, &ANIMATION_SHEETS }) {
+        for (const auto& sheet : *list) {
+            if (!hasAtlasRegion(sheet)) {
+                loader.loadTextureAsync(sheet, sheet);
+            }
+        }
+    }
 
-    // Basic Robot (Rock Robot)
-    loadTexture("RockRobot_Walk.png", "RockRobot_Walk.png");
-    loadTexture("RobotRock_Dead.png", "RobotRock_Dead.png");
-    loadTexture("RockRobot_Hit.png", "RockRobot_Hit.png");
+    // Fonts are small and have no GPU upload; load on this thread
+    loadFont(GAME_FONT_NAME, GAME_FONT_FILE);
 }
 
 // Private Helper Methods
 
-// Load texture from file with error handling
+// Load texture from the packed archive, falling back to the loose file
 bool ResourceManager::loadTexture(const std::string& name, const std::string& filename) {
     auto texture = std::make_shared<sf::Texture>();
-    if (texture->loadFromFile(filename)) {
-        m_textures[name] = texture;
+    AssetArchive::View packed = AssetArchive::getInstance().find(filename);
+    bool loaded = packed ? texture->loadFromMemory(packed.data, packed.size) : texture->loadFromFile(filename);
+    if (loaded) {
+        storeTexture(name, std::move(texture));
+        return true;
+    }
+    return false;
+}
+
+// Upload an image decoded off-thread by AsyncAssetLoader
+bool ResourceManager::loadTextureFromImage(const std::string& name, const sf::Image& image) {
+    auto texture = std::make_shared<sf::Texture>();
+    if (texture->loadFromImage(image)) {
+        storeTexture(name, std::move(texture));
         return true;
     }
     return false;
 }
 
+// Hot reload: the sf::Texture object is kept, so sprites holding it see the new pixels
+bool ResourceManager::reloadTexture(const std::string& name, const sf::Image& image) {
+    auto it = m_textures.find(name);
+    if (it == m_textures.end() || !it->second.texture->loadFromImage(image)) {
+        return false;
+    }
+
+    CachedTexture& cached = it->second;
+    sf::Vector2u size = cached.texture->getSize();
+    m_textureBytes -= cached.bytes;
+    cached.bytes = static_cast<size_t>(size.x) * size.y * 4;
+    m_textureBytes += cached.bytes;
+    return true;
+}
+
+// Insert or replace a cache entry, keeping the byte total in step. A replaced
+// texture keeps its sf::Texture object, since sprites may hold raw pointers to it
+void ResourceManager::storeTexture(const std::string& name, std::shared_ptr<sf::Texture> texture) {
+    auto it = m_textures.find(name);
+    if (it == m_textures.end()) {
+        it = m_textures.emplace(name, CachedTexture()).first;
+        it->second.texture = std::move(texture);
+    }
+    else {
+        it->second.texture->swap(*texture);
+        m_textureBytes -= it->second.bytes;
+    }
+
+    CachedTexture& cached = it->second;
+    sf::Vector2u size = cached.texture->getSize();
+    cached.bytes = static_cast<size_t>(size.x) * size.y * 4;
+    cached.lastUse = ++m_useClock;
+    m_textureBytes += cached.bytes;
+}
+
 // Load font from file with fallback options
 bool ResourceManager::loadFont(const std::string& name, const std::string& filename) {
     auto font = std::make_shared<sf::Font>();
 
+    // sf::Font reads glyphs lazily from the buffer; the archive mapping outlives it
+    AssetArchive::View packed = AssetArchive::getInstance().find(filename);
+    if (packed && font->loadFromMemory(packed.data, packed.size)) {
+        m_fonts[name] = { font, packed.size };
+        return true;
+    }
+
     // Try multiple font paths for compatibility
     std::vector<std::string> fontPaths = {
         filename,                          // Game font
@@ -171,7 +618,7 @@ bool ResourceManager::loadFont(const std::string& name, const std::string& filen
 
     for (const auto& path : fontPaths) {
         if (font->loadFromFile(path)) {
-            m_fonts[name] = font;
+            m_fonts[name] = { font, fileSize(path) };
             return true;
         }
     }
@@ -190,9 +637,28 @@ size_t ResourceManager::getFontCount() const {
     return m_fonts.size();
 }
 
-// Estimate total memory usage (simplified calculation)
 size_t ResourceManager::getTotalMemoryUsage() const {
-    return (m_textures.size() + m_fonts.size()) * 1024; // Rough estimate
+    return getMemoryUsage().total();
+}
+
+ResourceMemoryUsage ResourceManager::getMemoryUsage() const {
+    ResourceMemoryUsage usage;
+    usage.textureBytes = m_textureBytes;
+    for (const auto& [name, cached] : m_fonts) {
+        usage.fontBytes += cached.sourceBytes;
+    }
+    usage.soundBytes = AudioManager::getInstance().getSoundMemoryUsage();
+    return usage;
+}
+
+size_t ResourceManager::getTextureBytes(const std::string& name) const {
+    auto it = m_textures.find(name);
+    return (it != m_textures.end()) ? it->second.bytes : 0;
+}
+
+bool ResourceManager::isTextureReferenced(const std::string& name) const {
+    auto it = m_textures.find(name);
+    return it != m_textures.end() && (it->second.borrowed || it->second.texture.use_count() > 1);
 }
 
 // Template helper for generic resource loading (for future extension)
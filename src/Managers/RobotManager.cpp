@@ -27,7 +27,7 @@ void RobotManager::update(float dt) {
 }
 
 // Render all active robots
-void RobotManager::draw(sf::RenderWindow& window) const {
+void RobotManager::draw(sf::RenderTarget& window) const {
     EntityManager<Robot>::draw(window);
 }
 
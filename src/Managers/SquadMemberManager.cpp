@@ -96,7 +96,7 @@ void SquadMemberManager::update(float dt) {
 }
 
 // Render all active units
-void SquadMemberManager::draw(sf::RenderWindow& window) const {
+void SquadMemberManager::draw(sf::RenderTarget& window) const {
     for (const auto& unit : m_entities) {
         unit->draw(window);
     }
@@ -220,7 +220,7 @@ float WaveManager::getCountdownTime() const {
 }
 
 // Countdown display rendering
-void WaveManager::renderCountdown(sf::RenderWindow& window) {
+void WaveManager::renderCountdown(sf::RenderTarget& window) {
     if (m_countdownPhase == GameTypes::CountdownPhase::None || !m_countdownTextSetup) {
         return;
     }
@@ -371,7 +371,7 @@ void WaveManager::setupCountdownText() {
 
     try {
         // Try to load primary font
-        auto& font = ResourceManager::getInstance().getFont("bruce");
+        auto& font = ResourceManager::getInstance().getFont(FontId::Game);
 
         // Setup countdown number text (large, bold)
         m_countdownText.setFont(font);
@@ -388,7 +388,7 @@ void WaveManager::setupCountdownText() {
     catch (...) {
         // Fallback to system font
         try {
-            auto& fallbackFont = ResourceManager::getInstance().getFont("DejaVuSans.ttf");
+            auto& fallbackFont = ResourceManager::getInstance().getFont(FontId::Ui);
 
             m_countdownText.setFont(fallbackFont);
             m_countdownText.setCharacterSize(64);
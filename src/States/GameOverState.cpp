@@ -24,7 +24,7 @@ GameOverState::GameOverState(Game* game, StateMachine* machine, Reason reason,
 
 // State lifecycle - play defeat sound
 void GameOverState::onEnter() {
-    AudioManager::getInstance().playSound("gameover", AudioManager::AudioCategory::UI ,0.3f);
+    AudioManager::getInstance().playSound(SoundId::GameOver, AudioManager::AudioCategory::UI ,0.3f);
 }
 
 // State lifecycle - no cleanup needed
@@ -64,7 +64,7 @@ void GameOverState::update(float dt) {
 }
 
 // Render defeat screen with smoke effects
-void GameOverState::render(sf::RenderWindow& window) {
+void GameOverState::render(sf::RenderTarget& window) {
     window.draw(m_backgroundSprite);    // Background
     window.draw(m_titleText);           // "GAME OVER" title
     window.draw(m_statsText);           // Performance statistics
@@ -82,12 +82,12 @@ void GameOverState::render(sf::RenderWindow& window) {
 // Create and layout defeat interface elements
 void GameOverState::setupUI() {
     auto& rm = ResourceManager::getInstance();
-    sf::Font& font = rm.getFont("bruce");
-    sf::Texture& bgTexture = rm.getTexture("level_bg.png");
-    sf::Texture& btnTexture = rm.getTexture("btn.png");
+    sf::Font& font = rm.getFont(FontId::Game);
+    sf::Texture& btnTexture = rm.getTexture(TextureId::Button);
 
     // Setup semi-transparent background
-    m_backgroundSprite.setTexture(bgTexture);
+    m_backgroundTexture = rm.acquireScaledTexture("level_bg.png");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
     m_backgroundSprite.setColor(sf::Color(255, 255, 255, 120));
 
     const float centerX = GameConstants::WINDOW_WIDTH / 2.f;
@@ -155,7 +155,7 @@ void GameOverState::setupUI() {
 
         // Add click sound and callback
         btn->setClickCallback([=]() {
-            AudioManager::getInstance().playSound("click");
+            AudioManager::getInstance().playSound(SoundId::Click);
             def.callback();
             });
 
@@ -30,14 +30,14 @@ void LevelsState::setupUI() {
 // Setup back to menu navigation button
 void LevelsState::setupBackToMenuButton() {
     auto& rm = ResourceManager::getInstance();
-    m_backToMenuTexture = rm.getTexture("back_to_menu.png");
+    m_backToMenuTexture = rm.acquireTexture("back_to_menu.png");
 
-    m_backToMenuSprite.setTexture(m_backToMenuTexture);
+    m_backToMenuSprite.setTexture(*m_backToMenuTexture);
     m_backToMenuSprite.setScale(0.40f, 0.30f);
 
     // Position in top right corner with proper scaling
     sf::Vector2u windowSize = m_game->getWindow().getSize();
-    float spriteWidth = m_backToMenuTexture.getSize().x * 0.40f;
+    float spriteWidth = m_backToMenuTexture->getSize().x * 0.40f;
     m_backToMenuSprite.setPosition(
         windowSize.x - spriteWidth - 20.f,  // 20px margin from right edge
         60.f                                // 60px from top
@@ -48,20 +48,20 @@ void LevelsState::setupBackToMenuButton() {
 
 // Setup decorative warning tape elements
 void LevelsState::setupWarningTape() {
-    m_warningTapeTexture = ResourceManager::getInstance().getTexture("warningTape.png");
+    m_warningTapeTexture = ResourceManager::getInstance().acquireTexture("warningTape.png");
 
     // Scale tape to span entire map width
-    float scaleX = m_totalMapWidth / static_cast<float>(m_warningTapeTexture.getSize().x);
+    float scaleX = m_totalMapWidth / static_cast<float>(m_warningTapeTexture->getSize().x);
     float scaleY = 1.0f;
 
     // Top warning tape
-    m_warningTapeTop.setTexture(m_warningTapeTexture);
+    m_warningTapeTop.setTexture(*m_warningTapeTexture);
     m_warningTapeTop.setScale(scaleX, scaleY);
     m_warningTapeTop.setPosition(0.f, 0.f);
 
     // Bottom warning tape
-    float bottomY = static_cast<float>(m_game->getWindow().getSize().y - m_warningTapeTexture.getSize().y * scaleY);
-    m_warningTapeBottom.setTexture(m_warningTapeTexture);
+    float bottomY = static_cast<float>(m_game->getWindow().getSize().y - m_warningTapeTexture->getSize().y * scaleY);
+    m_warningTapeBottom.setTexture(*m_warningTapeTexture);
     m_warningTapeBottom.setScale(scaleX, scaleY);
     m_warningTapeBottom.setPosition(0.f, bottomY);
 }
@@ -69,25 +69,25 @@ void LevelsState::setupWarningTape() {
 // Load and setup three-part panoramic background
 void LevelsState::loadBackgroundImages() {
     auto& rm = ResourceManager::getInstance();
-    m_leftTexture = rm.getTexture("levelbackground_left.png");
-    m_middleTexture = rm.getTexture("levelbackground_middle.png");
-    m_rightTexture = rm.getTexture("levelbackground_right.png");
+    m_leftTexture = rm.acquireScaledTexture("levelbackground_left.png");
+    m_middleTexture = rm.acquireScaledTexture("levelbackground_middle.png");
+    m_rightTexture = rm.acquireScaledTexture("levelbackground_right.png");
 
     // Calculate scaling to fit window height
     sf::Vector2u windowSize = m_game->getWindow().getSize();
-    float scaleY = static_cast<float>(windowSize.y) / m_leftTexture.getSize().y;
-    float scaledWidth = m_leftTexture.getSize().x * scaleY;
+    float scaleY = static_cast<float>(windowSize.y) / m_leftTexture->getSize().y;
+    float scaledWidth = m_leftTexture->getSize().x * scaleY;
 
     // Position three background sections seamlessly
-    m_leftBackground.setTexture(m_leftTexture);
+    m_leftBackground.setTexture(*m_leftTexture);
     m_leftBackground.setPosition(0, 0);
     m_leftBackground.setScale(scaleY, scaleY);
 
-    m_middleBackground.setTexture(m_middleTexture);
+    m_middleBackground.setTexture(*m_middleTexture);
     m_middleBackground.setPosition(scaledWidth, 0);
     m_middleBackground.setScale(scaleY, scaleY);
 
-    m_rightBackground.setTexture(m_rightTexture);
+    m_rightBackground.setTexture(*m_rightTexture);
     m_rightBackground.setPosition(scaledWidth * 2.0f, 0);
     m_rightBackground.setScale(scaleY, scaleY);
 
@@ -97,7 +97,9 @@ void LevelsState::loadBackgroundImages() {
 // Generate positions for level buttons along the map
 void LevelsState::generateLevelPositions() {
     m_levelPositions.clear();
-    float scale = static_cast<float>(m_game->getWindow().getSize().y) / m_leftTexture.getSize().y;
+    // Positions are in original image pixels, whatever variant is loaded
+    sf::Vector2u sourceSize = ResourceManager::getInstance().getSourceSize("levelbackground_left.png");
+    float scale = static_cast<float>(m_game->getWindow().getSize().y) / sourceSize.y;
 
     // Predefined positions for 17 levels across the panoramic map
     std::vector<sf::Vector2f> raw = {
@@ -115,7 +117,7 @@ void LevelsState::generateLevelPositions() {
 
 void LevelsState::setupLevelButtons() {
     m_levelButtons.clear();
-    const auto& font = ResourceManager::getInstance().getFont("bruce");
+    const auto& font = ResourceManager::getInstance().getFont(FontId::Game);
     const auto& texture = ResourceManager::getInstance().getTexture("level_btn.png");
     const sf::IntRect fullRect(0, 0, texture.getSize().x, texture.getSize().y);
 
@@ -171,9 +173,6 @@ void LevelsState::handleEvent(const sf::Event& event) {
     sf::Vector2f worldMouse = m_game->getWindow().mapPixelToCoords(
         sf::Mouse::getPosition(m_game->getWindow()), m_mapView);
 
-    sf::View originalView = m_game->getWindow().getView();
-    m_game->getWindow().setView(m_mapView);
-
     // Forward adjusted events to each button
     for (auto& button : m_levelButtons) {
         sf::Event adjusted = event;
@@ -189,9 +188,6 @@ void LevelsState::handleEvent(const sf::Event& event) {
 
         button->handleEvent(adjusted);
     }
-
-    // Restore original view
-    m_game->getWindow().setView(originalView);
 }
 
 
@@ -239,7 +235,7 @@ void LevelsState::update(float dt) {
     updateMapView();
 }
 
-void LevelsState::render(sf::RenderWindow& window) {
+void LevelsState::render(sf::RenderTarget& window) {
     window.setView(m_mapView);
     window.draw(m_leftBackground);
     window.draw(m_middleBackground);
@@ -254,7 +250,7 @@ void LevelsState::render(sf::RenderWindow& window) {
     window.draw(m_backToMenuSprite);
 
     sf::Text hint("Drag or use arrow keys to scroll",
-        ResourceManager::getInstance().getFont("bruce"));
+        ResourceManager::getInstance().getFont(FontId::Game));
     hint.setCharacterSize(20);
     hint.setFillColor(sf::Color::White);
     hint.setPosition(10, 10);
@@ -271,7 +267,7 @@ void LevelsState::onExit() {
 }
 
 void LevelsState::onLevelSelected(int levelIndex) {
-    AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI);
+    AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI);
 
     int selectedLevel = levelIndex + 1;
     m_machine->changeState(std::make_unique<PlayState>(m_game, m_machine, selectedLevel));
@@ -8,10 +8,11 @@
 
 MenuState::MenuState(Game* game, StateMachine* machine)
     : m_game(game), m_machine(machine) {
-    m_backgroundSprite.setTexture(ResourceManager::getInstance().getTexture("menu_background.png"));
+    m_backgroundTexture = ResourceManager::getInstance().acquireScaledTexture("menu_background.png");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
 
-    sf::Texture& btnTexture = ResourceManager::getInstance().getTexture("btn.png");
-    sf::Font& font = ResourceManager::getInstance().getFont("bruce");
+    sf::Texture& btnTexture = ResourceManager::getInstance().getTexture(TextureId::Button);
+    sf::Font& font = ResourceManager::getInstance().getFont(FontId::Game);
     sf::IntRect fullRect(0, 0, btnTexture.getSize().x, btnTexture.getSize().y);
     sf::Vector2f buttonSize(250.f, 60.f);
 
@@ -66,7 +67,7 @@ void MenuState::update(float dt) {
     m_titleAnimationTime += dt;
 }
 
-void MenuState::render(sf::RenderWindow& window) {
+void MenuState::render(sf::RenderTarget& window) {
     // Stretch background to match window size
     sf::Vector2u windowSize = window.getSize();
     sf::Vector2u textureSize = m_backgroundSprite.getTexture()->getSize();
@@ -9,8 +9,8 @@
 MoreState::MoreState(Game* game, StateMachine* machine)
     : m_game(game), m_machine(machine) {
 
-    sf::Font& font = ResourceManager::getInstance().getFont("bruce");
-    sf::Texture& btnTexture = ResourceManager::getInstance().getTexture("btn.png");
+    sf::Font& font = ResourceManager::getInstance().getFont(FontId::Game);
+    sf::Texture& btnTexture = ResourceManager::getInstance().getTexture(TextureId::Button);
 
     m_backButton = std::make_unique<Button>(
         sf::Vector2f(20.f, 20.f),
@@ -129,7 +129,7 @@ void MoreState::onEnter() {
     }
 
     // Optional: Play synced audio here if needed
-    AudioManager::getInstance().playSound("more", AudioManager::AudioCategory::Music);
+    AudioManager::getInstance().playSound(SoundId::More, AudioManager::AudioCategory::Music);
 }
 
 
@@ -173,7 +173,7 @@ void MoreState::update(float dt) {
         m_backButton->update(dt);
 }
 
-void MoreState::render(sf::RenderWindow& window) {
+void MoreState::render(sf::RenderTarget& window) {
     window.draw(m_videoSprite);
     if (m_backButton)
         m_backButton->draw(window);
@@ -61,7 +61,7 @@ void PauseState::update(float dt) {
 }
 
 // Render semi-transparent overlay and pause menu
-void PauseState::render(sf::RenderWindow& window) {
+void PauseState::render(sf::RenderTarget& window) {
     renderOverlay(window);      // Semi-transparent background
     renderMenu(window);         // Pause menu content
 }
@@ -69,12 +69,12 @@ void PauseState::render(sf::RenderWindow& window) {
 // Initialize UI elements and layout
 void PauseState::setupUI() {
     // Create semi-transparent background overlay
-    sf::Texture& bg = ResourceManager::getInstance().getTexture("level_bg.png");
-    m_backgroundSprite.setTexture(bg);
+    m_backgroundTexture = ResourceManager::getInstance().acquireScaledTexture("level_bg.png");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
     m_backgroundSprite.setColor(sf::Color(255, 255, 255, 120));  // Semi-transparent
 
     // Setup pause title text
-    sf::Font& font = ResourceManager::getInstance().getFont("bruce");
+    sf::Font& font = ResourceManager::getInstance().getFont(FontId::Game);
     m_pauseTitle.setFont(font);
     m_pauseTitle.setString("PAUSED");
     m_pauseTitle.setCharacterSize(48);
@@ -93,8 +93,8 @@ void PauseState::setupButtons() {
     m_buttons.clear();
 
     // Load button assets
-    const sf::Texture& btnTex = ResourceManager::getInstance().getTexture("btn.png");
-    const sf::Font& font = ResourceManager::getInstance().getFont("bruce");
+    const sf::Texture& btnTex = ResourceManager::getInstance().getTexture(TextureId::Button);
+    const sf::Font& font = ResourceManager::getInstance().getFont(FontId::Game);
 
     // Button layout configuration
     sf::Vector2f center(GameConstants::WINDOW_WIDTH / 2.f, 240.f);
@@ -104,19 +104,19 @@ void PauseState::setupButtons() {
     // Define button actions with audio feedback
     std::vector<std::pair<std::string, std::function<void()>>> actions = {
         {"Resume", [this]() {
-            AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI);
+            AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI);
             onResumeButton();
         }},
         {"Settings", [this]() {
-            AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI);
+            AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI);
             onSettingsButton();
         }},
         {"Main Menu", [this]() {
-            AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI);
+            AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI);
             onMainMenuButton();
         }},
         {"Quit", [this]() {
-            AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI);
+            AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI);
             onQuitButton();
         }}
     };
@@ -155,12 +155,12 @@ void PauseState::updateButtonHover(const sf::Vector2f& mousePos) {
 }
 
 // Render semi-transparent background overlay
-void PauseState::renderOverlay(sf::RenderWindow& window) {
+void PauseState::renderOverlay(sf::RenderTarget& window) {
     window.draw(m_backgroundSprite);
 }
 
 // Render pause menu content
-void PauseState::renderMenu(sf::RenderWindow& window) {
+void PauseState::renderMenu(sf::RenderTarget& window) {
     window.draw(m_pauseTitle);
     for (auto& btn : m_buttons)
         btn->draw(window);
@@ -18,6 +18,8 @@
 #include "Managers/WaveManager.h"
 #include "Factories/CollectibleFactory.h"
 #include "Systems/AnimationSystem.h"
+#include "Graphics/HealthBarBatch.h"
+#include "Graphics/RenderQueue.h"
 #include "Systems/EventSystem.h"
 #include "Commands/PlaceUnitCommand.h"
 #include "Commands/PlaceBombCommand.h"
@@ -43,13 +45,13 @@ PlayState::PlayState(Game* game, StateMachine* machine, int level)
     // Load unit textures - sniper locked until level 9
     auto& rm = ResourceManager::getInstance();
     m_unitTextures = {
-        rm.getTexture("select1.png"),
-        rm.getTexture("select2.png"),
-        (m_currentLevel >= 9) ? rm.getTexture("select3.png") : rm.getTexture("Sniper_Locked.png")
+        rm.acquireTexture("select1.png"),
+        rm.acquireTexture("select2.png"),
+        rm.acquireTexture((m_currentLevel >= 9) ? "select3.png" : "Sniper_Locked.png")
     };
 
-    m_lockedMessageTexture = rm.getTexture("Locked_Message.png");
-    m_healthPackTexture = rm.getTexture("select_medkit.png");
+    m_lockedMessageTexture = rm.acquireTexture("Locked_Message.png");
+    m_healthPackTexture = rm.acquireTexture("select_medkit.png");
 
     // Load unit costs from config
     auto& config = ConfigLoader::getInstance();
@@ -123,7 +125,7 @@ void PlayState::handleMouseHover(const sf::Vector2f& mousePos) {
     }
     // Play hover sound when starting to hover
     if (!wasHovering && m_isHoveringLockedSniper) {
-        AudioManager::getInstance().playSound("button_hover", AudioManager::AudioCategory::UI, 0.5f);
+        AudioManager::getInstance().playSound(SoundId::ButtonHover, AudioManager::AudioCategory::UI, 0.5f);
     }
 }
 // Handle mouse clicks on UI elements
@@ -137,7 +139,7 @@ void PlayState::handleMouseEvents(const sf::Event& event) {
             m_commandManager->undo();
         }
         else {
-            AudioManager::getInstance().playSound("error", AudioManager::AudioCategory::UI);
+            AudioManager::getInstance().playSound(SoundId::Error, AudioManager::AudioCategory::UI);
         }
         return;
     }
@@ -147,7 +149,7 @@ void PlayState::handleMouseEvents(const sf::Event& event) {
             m_commandManager->redo();
         }
         else {
-            AudioManager::getInstance().playSound("error", AudioManager::AudioCategory::UI);
+            AudioManager::getInstance().playSound(SoundId::Error, AudioManager::AudioCategory::UI);
         }
         return;
     }
@@ -202,7 +204,7 @@ void PlayState::handleMouseEvents(const sf::Event& event) {
 }
 // Handle object placement on the game grid
 void PlayState::handleObjectPlacement(const sf::Vector2f& mousePos) {
-    AudioManager::getInstance().playSound("placed", AudioManager::AudioCategory::UI);
+    AudioManager::getInstance().playSound(SoundId::Placed, AudioManager::AudioCategory::UI);
     if (m_healthPackMode) {
         handleHealthPackUsage(mousePos);
     }
@@ -308,9 +310,7 @@ void PlayState::update(float dt) {
             m_showNotEnoughCoinsMessage = false;
         }
     }
-    // Update core game systems
-    AnimationSystem::getInstance().update(dt);
-    EventSystem::getInstance().processEvents();
+    // Animation and event dispatch are ticked once per frame by the SystemScheduler
     m_gridRenderer->update(dt);
 
     if (m_gameManager) {
@@ -329,44 +329,83 @@ void PlayState::update(float dt) {
     }
 }
 // Render all game elements
-void PlayState::render(sf::RenderWindow& window) {
+void PlayState::render(sf::RenderTarget& window) {
     if (m_paused) return;
 
     renderBackground(window);
     renderGameContent(window);
     renderUI(window);
 }
-// Render background image
-void PlayState::renderBackground(sf::RenderWindow& window) {
+// Render background and grid slots from the cached static layer
+void PlayState::renderBackground(sf::RenderTarget& window) {
+    sf::Vector2u winSize = window.getSize();
+
+    // Re-bake only on resize or when the grid's look changed
+    if (winSize != m_staticLayerSize || m_gridRenderer->getRevision() != m_staticLayerRevision) {
+        bakeStaticLayer(winSize);
+    }
+
+    if (m_staticLayerBaked) {
+        window.draw(m_staticLayerSprite);
+    }
+    else {
+        drawStaticLayer(window, winSize);  // Render textures unavailable - draw directly
+    }
+}
+
+// Composite background and grid slots into the static layer texture
+void PlayState::bakeStaticLayer(const sf::Vector2u& size) {
+    m_staticLayerSize = size;
+    m_staticLayerRevision = m_gridRenderer->getRevision();
+    m_staticLayerBaked = m_staticLayer.create(size.x, size.y);
+    if (!m_staticLayerBaked) return;
+
+    m_staticLayer.clear();
+    drawStaticLayer(m_staticLayer, size);
+    m_staticLayer.display();
+    m_staticLayerSprite.setTexture(m_staticLayer.getTexture(), true);
+}
+
+// Draw background scaled to the target size, then the placement grid
+void PlayState::drawStaticLayer(sf::RenderTarget& target, const sf::Vector2u& size) const {
+    TextureHandle background = ResourceManager::getInstance().acquireScaledTexture("level_bg.png");
     sf::Sprite bg;
-    bg.setTexture(ResourceManager::getInstance().getTexture("level_bg.png"));
+    bg.setTexture(*background);
 
-    // Scale background to fit window
-    sf::Vector2u winSize = window.getSize();
     sf::Vector2u texSize = bg.getTexture()->getSize();
     bg.setScale(
-        static_cast<float>(winSize.x) / texSize.x,
-        static_cast<float>(winSize.y) / texSize.y
+        static_cast<float>(size.x) / texSize.x,
+        static_cast<float>(size.y) / texSize.y
     );
-    window.draw(bg);
-}
-// Render game content (grid, units, bombs, animations)
-void PlayState::renderGameContent(sf::RenderWindow& window) {
-    m_gridRenderer->draw(window);
+    target.draw(bg);
 
+    m_gridRenderer->draw(target);
+}
+// Render game content (units, bombs, animations)
+void PlayState::renderGameContent(sf::RenderTarget& window) {
     if (m_gameManager) {
         m_gameManager->render(window);
     }
 
-    AnimationSystem::getInstance().render(window);
+    AnimationSystem::getInstance().queueRenderables();
 
-    // Render active bombs
+    // Queue active bombs
     for (const auto& bomb : m_bombs) {
         bomb.render(window);
     }
+
+    // Sorted by layer, lane depth and texture, then drawn in batches
+    RenderQueue::getInstance().flush(window);
+
+    // All health bars queued by the entity layer, in one draw call
+    HealthBarBatch::getInstance().flush(window);
+
+    if (m_gameManager) {
+        m_gameManager->renderHUD(window);
+    }
 }
 // Render all UI elements
-void PlayState::renderUI(sf::RenderWindow& window) {
+void PlayState::renderUI(sf::RenderTarget& window) {
     renderUnitSelectionIcons(window);
     renderCommandIcons(window);
     renderSpecialIcons(window);
@@ -394,7 +433,7 @@ void PlayState::renderUI(sf::RenderWindow& window) {
     }
 }
 // Render unit selection icons at bottom of screen
-void PlayState::renderUnitSelectionIcons(sf::RenderWindow& window) {
+void PlayState::renderUnitSelectionIcons(sf::RenderTarget& window) {
     sf::Vector2u winSize = window.getSize();
     float iconSize = 130.f;
     float spacing = 15.f;
@@ -405,10 +444,10 @@ void PlayState::renderUnitSelectionIcons(sf::RenderWindow& window) {
 
     for (int i = 0; i < 3; ++i) {
         sf::Sprite icon;
-        icon.setTexture(m_unitTextures[i]);
+        icon.setTexture(*m_unitTextures[i]);
         icon.setScale(
-            iconSize / m_unitTextures[i].getSize().x,
-            iconSize / m_unitTextures[i].getSize().y
+            iconSize / m_unitTextures[i]->getSize().x,
+            iconSize / m_unitTextures[i]->getSize().y
         );
         icon.setPosition(startX + i * (iconSize + spacing), startY);
         m_unitIconBounds.push_back(icon.getGlobalBounds());
@@ -422,12 +461,12 @@ void PlayState::renderUnitSelectionIcons(sf::RenderWindow& window) {
     }
 }
 // Render bomb icon
-void PlayState::renderSpecialIcons(sf::RenderWindow& window) {
+void PlayState::renderSpecialIcons(sf::RenderTarget& window) {
     sf::Vector2u winSize = window.getSize();
     float iconSize = 120.f;
 
     sf::Sprite bombIcon;
-    bombIcon.setTexture(ResourceManager::getInstance().getTexture("select-b.png"));
+    bombIcon.setTexture(ResourceManager::getInstance().getTexture(TextureId::BombIcon));
     bombIcon.setScale(
         iconSize / bombIcon.getTexture()->getSize().x,
         iconSize / bombIcon.getTexture()->getSize().y
@@ -440,7 +479,7 @@ void PlayState::renderSpecialIcons(sf::RenderWindow& window) {
     window.draw(bombIcon);
 }
 // Render health pack icon with counter
-void PlayState::renderHealthPackIcon(sf::RenderWindow& window) {
+void PlayState::renderHealthPackIcon(sf::RenderTarget& window) {
     sf::Vector2u winSize = window.getSize();
     float iconSize = 130.f;
     float spacing = 15.f;
@@ -448,8 +487,8 @@ void PlayState::renderHealthPackIcon(sf::RenderWindow& window) {
     sf::Vector2f healthPos(bombPos.x - iconSize - spacing + 15.f, bombPos.y + 10.f);
 
     sf::Sprite healthIcon;
-    healthIcon.setTexture(m_healthPackTexture);
-    healthIcon.setScale(iconSize / m_healthPackTexture.getSize().x, iconSize / m_healthPackTexture.getSize().y);
+    healthIcon.setTexture(*m_healthPackTexture);
+    healthIcon.setScale(iconSize / m_healthPackTexture->getSize().x, iconSize / m_healthPackTexture->getSize().y);
     healthIcon.setPosition(healthPos);
 
     m_healthPackIconBounds = healthIcon.getGlobalBounds();
@@ -461,7 +500,7 @@ void PlayState::renderHealthPackIcon(sf::RenderWindow& window) {
     // Render health pack counter
     if (m_gameManager) {
         sf::Text counter;
-        counter.setFont(ResourceManager::getInstance().getFont("bruce"));
+        counter.setFont(ResourceManager::getInstance().getFont(FontId::Game));
         counter.setCharacterSize(15);
         counter.setFillColor(sf::Color::White);
         counter.setString(std::to_string(m_gameManager->getHealthPackCount()));
@@ -470,12 +509,12 @@ void PlayState::renderHealthPackIcon(sf::RenderWindow& window) {
     }
 }
 // Render coin display with current amount
-void PlayState::renderCoinDisplay(sf::RenderWindow& window) {
+void PlayState::renderCoinDisplay(sf::RenderTarget& window) {
     const int coins = m_gameManager ? m_gameManager->getCoins() : 0;
 
     window.draw(m_coinUISprite);
     sf::Text coinText;
-    coinText.setFont(ResourceManager::getInstance().getFont("bruce"));
+    coinText.setFont(ResourceManager::getInstance().getFont(FontId::Game));
     coinText.setCharacterSize(25);
     coinText.setFillColor(sf::Color::White);
     coinText.setStyle(sf::Text::Bold);
@@ -496,7 +535,7 @@ void PlayState::renderCoinDisplay(sf::RenderWindow& window) {
     window.draw(coinText);
 }
 // Render undo/redo command icons
-void PlayState::renderCommandIcons(sf::RenderWindow& window) {
+void PlayState::renderCommandIcons(sf::RenderTarget& window) {
     sf::Vector2u winSize = window.getSize();
     float iconSize = 90.f;
     float spacing = 15.f;
@@ -506,8 +545,8 @@ void PlayState::renderCommandIcons(sf::RenderWindow& window) {
 
     // Undo icon
     sf::Sprite undoIcon;
-    undoIcon.setTexture(m_undoTexture);
-    undoIcon.setScale(iconSize / m_undoTexture.getSize().x, iconSize / m_undoTexture.getSize().y);
+    undoIcon.setTexture(*m_undoTexture);
+    undoIcon.setScale(iconSize / m_undoTexture->getSize().x, iconSize / m_undoTexture->getSize().y);
     undoIcon.setPosition(30.f, commandIconY);
 
     // Gray out if unavailable
@@ -519,8 +558,8 @@ void PlayState::renderCommandIcons(sf::RenderWindow& window) {
 
     // Redo icon
     sf::Sprite redoIcon;
-    redoIcon.setTexture(m_redoTexture);
-    redoIcon.setScale(iconSize / m_redoTexture.getSize().x, iconSize / m_redoTexture.getSize().y);
+    redoIcon.setTexture(*m_redoTexture);
+    redoIcon.setScale(iconSize / m_redoTexture->getSize().x, iconSize / m_redoTexture->getSize().y);
     redoIcon.setPosition(30.f + 130.f + spacing, commandIconY);
 
     // Gray out if unavailable
@@ -531,11 +570,11 @@ void PlayState::renderCommandIcons(sf::RenderWindow& window) {
     window.draw(redoIcon);
 }
 // Render level select button and current level display
-void PlayState::renderLevelSelect(sf::RenderWindow& window) {
+void PlayState::renderLevelSelect(sf::RenderTarget& window) {
     window.draw(m_levelSelectSprite);
 
     sf::Text levelText;
-    levelText.setFont(ResourceManager::getInstance().getFont("bruce"));
+    levelText.setFont(ResourceManager::getInstance().getFont(FontId::Game));
     levelText.setCharacterSize(20);
     levelText.setFillColor(sf::Color::White);
     levelText.setStyle(sf::Text::Bold);
@@ -552,7 +591,7 @@ void PlayState::renderLevelSelect(sf::RenderWindow& window) {
     window.draw(levelText);
 }
 // Render locked sniper message with smooth fade effect
-void PlayState::renderLockedMessage(sf::RenderWindow& window) {
+void PlayState::renderLockedMessage(sf::RenderTarget& window) {
     // Only render if there's some alpha (visible)
     if (m_lockedMessageAlpha <= 0.0f) return;
 
@@ -564,14 +603,14 @@ void PlayState::renderLockedMessage(sf::RenderWindow& window) {
     float sniperIconX = startX + 2 * (iconSize + spacing);
 
     sf::Sprite lockedMessage;
-    lockedMessage.setTexture(m_lockedMessageTexture);
+    lockedMessage.setTexture(*m_lockedMessageTexture);
 
     // Scale and position message above sniper icon
     float messageWidth = 150.f;
     float messageHeight = 75.f;
     lockedMessage.setScale(
-        messageWidth / m_lockedMessageTexture.getSize().x,
-        messageHeight / m_lockedMessageTexture.getSize().y
+        messageWidth / m_lockedMessageTexture->getSize().x,
+        messageHeight / m_lockedMessageTexture->getSize().y
     );
 
     lockedMessage.setPosition(
@@ -602,17 +641,17 @@ float PlayState::calculateMessageAlpha(float elapsedTime) const {
 }
 
 void PlayState::onEnter() {
-    m_coinUITexture = ResourceManager::getInstance().getTexture("CoinUI.png");
-    m_coinUISprite.setTexture(m_coinUITexture);
+    m_coinUITexture = ResourceManager::getInstance().acquireTexture("CoinUI.png");
+    m_coinUISprite.setTexture(*m_coinUITexture);
     m_coinUISprite.setScale(0.35f, 0.35f);
     m_coinUISprite.setPosition(10.f, 10.f);
 
     auto& rm = ResourceManager::getInstance();
-    m_undoTexture = rm.getTexture("undo.png");
-    m_redoTexture = rm.getTexture("redo.png");
-    m_levelSelectTexture = rm.getTexture("select_level.png");
+    m_undoTexture = rm.acquireTexture("undo.png");
+    m_redoTexture = rm.acquireTexture("redo.png");
+    m_levelSelectTexture = rm.acquireTexture("select_level.png");
 
-    m_levelSelectSprite.setTexture(m_levelSelectTexture);
+    m_levelSelectSprite.setTexture(*m_levelSelectTexture);
     m_levelSelectSprite.setScale(0.30f, 0.20f);
 
     sf::Vector2u winSize = m_game->getWindow().getSize();
@@ -620,7 +659,7 @@ void PlayState::onEnter() {
     m_levelSelectBounds = m_levelSelectSprite.getGlobalBounds();
 
     // Setup not enough coins text
-    m_notEnoughCoinsText.setFont(ResourceManager::getInstance().getFont("bruce"));
+    m_notEnoughCoinsText.setFont(ResourceManager::getInstance().getFont(FontId::Game));
     m_notEnoughCoinsText.setString("Not Enough Coins!");
     m_notEnoughCoinsText.setCharacterSize(48);
     m_notEnoughCoinsText.setStyle(sf::Text::Bold);
@@ -643,7 +682,8 @@ void PlayState::onEnter() {
 }
 // Cleanup when exiting state
 void PlayState::onExit() {
-    EventSystem::getInstance().clear();
+    // Subscribers unregister themselves; only events about this level are dropped
+    EventSystem::getInstance().discardQueuedEvents();
 }
 // Handle pause state
 void PlayState::onPause() {
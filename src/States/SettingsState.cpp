@@ -54,7 +54,7 @@ void SettingsState::update(float dt) {
 }
 
 // Render settings interface
-void SettingsState::render(sf::RenderWindow& window) {
+void SettingsState::render(sf::RenderTarget& window) {
     window.draw(m_backgroundSprite);    // Background
     window.draw(m_titleText);           // "Settings" title
 
@@ -70,13 +70,13 @@ void SettingsState::render(sf::RenderWindow& window) {
 // Initialize complete settings UI layout
 void SettingsState::setupUI() {
     auto& rm = ResourceManager::getInstance();
-    sf::Font& font = rm.getFont("bruce");
-    sf::Texture& bg = rm.getTexture("level_bg.png");
-    sf::Texture& btnTex = rm.getTexture("btn.png");
-    sf::Texture& knobTex = rm.getTexture("slider_knob.png");
+    sf::Font& font = rm.getFont(FontId::Game);
+    sf::Texture& btnTex = rm.getTexture(TextureId::Button);
+    sf::Texture& knobTex = rm.getTexture(TextureId::SliderKnob);
 
     // Setup semi-transparent background
-    m_backgroundSprite.setTexture(bg);
+    m_backgroundTexture = rm.acquireScaledTexture("level_bg.png");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
     m_backgroundSprite.setColor(sf::Color(255, 255, 255, 120));
 
     // Setup title text
@@ -169,5 +169,5 @@ void SettingsState::onApply() {
     sm.saveSettings();
 
     // Play confirmation sound
-    AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI);
+    AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI);
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
 ﻿// ================================
-// Splash State - Multithreaded Asset Loading with Animated Fade Transitions
+// Splash State - Asynchronous Asset Loading with Animated Fade Transitions
 // ================================
 #include "States/SplashState.h"
 #include "States/MenuState.h"
 #include "States/StateMachine.h"
-#include "Managers/ResourceManager.h"
 #include "Managers/AudioManager.h"
+#include "Systems/EventSystem.h"
 #include "Core/Game.h"
 #include <iostream>
 
@@ -18,13 +18,8 @@ SplashState::SplashState(Game* game, StateMachine* machine)
     positionLoadingText();
 }
 
-// Destructor - Ensure background thread is properly terminated
-SplashState::~SplashState() {
-    m_shouldStopLoading = true;
-    if (m_loadingThread.joinable()) {
-        m_loadingThread.join();
-    }
-}
+// Destructor - Queued loads keep going; the loader outlives this state
+SplashState::~SplashState() = default;
 
 // Initialize background image with fallback handling
 void SplashState::setupBackground() {
@@ -126,6 +121,7 @@ void SplashState::update(float dt) {
     m_totalTime += dt;
     updateAnimation(dt);
     updatePhase();
+    checkLoadingComplete();
 
     // Transition to menu when both animation and loading are complete
     if (m_currentPhase == Phase::Complete && m_assetsLoaded) {
@@ -216,7 +212,7 @@ float SplashState::calculateAlpha() {
 }
 
 // Render splash screen with appropriate content based on current phase
-void SplashState::render(sf::RenderWindow& window) {
+void SplashState::render(sf::RenderTarget& window) {
     sf::Vector2u windowSize = window.getSize();
     sf::Vector2u textureSize = m_backgroundSprite.getTexture()->getSize();
 
@@ -252,7 +248,7 @@ void SplashState::render(sf::RenderWindow& window) {
 }
 
 // Render text with specified alpha transparency
-void SplashState::renderTextWithAlpha(sf::RenderWindow& window, sf::Text& text, float alpha) {
+void SplashState::renderTextWithAlpha(sf::RenderTarget& window, sf::Text& text, float alpha) {
     sf::Color color = text.getFillColor();
     color.a = static_cast<sf::Uint8>(std::max(0.0f, std::min(255.0f, alpha)));
     text.setFillColor(color);
@@ -265,43 +261,37 @@ void SplashState::renderTextWithAlpha(sf::RenderWindow& window, sf::Text& text,
 // State lifecycle - start background music and asset loading
 void SplashState::onEnter() {
     AudioManager::getInstance().playMusic("Menu11", true);
-    startBackgroundLoading();
+
+    // Published by AsyncAssetLoader; handlers run during EventSystem::processEvents
+    auto& events = EventSystem::getInstance();
+    m_progressSubscription = events.subscribe<AssetLoadProgressEvent>([this](const AssetLoadProgressEvent& e) {
+        int percent = e.totalSteps > 0 ? e.completedSteps * 100 / e.totalSteps : 100;
+        m_loadingText.setString("PREPARING BATTLEFIELD... " + std::to_string(percent) + "%");
+        positionLoadingText();
+        });
+    m_failureSubscription = events.subscribe<AssetLoadFailedEvent>([](const AssetLoadFailedEvent& e) {
+        std::cerr << "Background loading error: " << e.message << std::endl;
+        });
 }
 
-// State lifecycle - cleanup audio and ensure thread termination
+// State lifecycle - cleanup audio and loader subscriptions
 void SplashState::onExit() {
     AudioManager::getInstance().stopMusic();
-    m_shouldStopLoading = true;
-    if (m_loadingThread.joinable()) {
-        m_loadingThread.join();
-    }
+    m_progressSubscription.reset();
+    m_failureSubscription.reset();
 }
 
-// Multithreading System
+// Asynchronous Loading System
 
-// Start background asset loading thread
-void SplashState::startBackgroundLoading() {
-    m_loadingThread = std::thread(&SplashState::loadAssetsInBackground, this);
-}
-
-// Background thread function for asset preloading
-void SplashState::loadAssetsInBackground() {
-    try {
-        ResourceManager& rm = ResourceManager::getInstance();
-
-        // Preload all game assets in background
-        rm.preloadMenuAssets();     // Menu textures and UI elements
-        rm.preloadGameAssets();     // Gameplay textures and sounds
-
-        m_assetsLoaded = true;      // Signal completion
-    }
-    catch (const std::exception& e) {
-        std::cerr << "Background loading error: " << e.what() << std::endl;
-        m_assetsLoaded = true;      // Continue even if some assets failed
+// Game's startup pipeline does the loading; the splash only waits for it
+void SplashState::checkLoadingComplete() {
+    if (!m_assetsLoaded && m_game->isStartupComplete()) {
+        m_assetsLoaded = true;
     }
 }
 
 // Transition to main menu when loading is complete
 void SplashState::transitionToMenu() {
+    m_game->logStartupMilestone("menu");
     m_machine->changeState(std::make_unique<MenuState>(m_game, m_machine));
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "States/StateMachine.h"
 #include "States/IState.h"
 #include "Core/Game.h"
+#include "Managers/ResourceManager.h"
 
 // Constructor - Initialize state machine with game reference
 StateMachine::StateMachine(Game* game)
@@ -32,7 +33,7 @@ void StateMachine::update(float dt) {
 }
 
 // Render current state (supports transparent state layering)
-void StateMachine::render(sf::RenderWindow& window) {
+void StateMachine::render(sf::RenderTarget& window) {
     if (!m_states.empty()) {
         // For future enhancement: could render multiple states if transparent
         m_states.top()->render(window);
@@ -66,6 +67,8 @@ void StateMachine::clearStates() {
 
 // Execute all queued state operations safely
 void StateMachine::processPendingOperations() {
+    if (m_pendingOperations.empty()) return;
+
     for (auto& operation : m_pendingOperations) {
         switch (operation.type) {
         case PendingOperation::Push:
@@ -109,6 +112,9 @@ void StateMachine::processPendingOperations() {
         }
     }
     m_pendingOperations.clear();  // Clear processed operations
+
+    // Exited states have dropped their texture handles; trim the cache now
+    ResourceManager::getInstance().enforceMemoryBudget();
 }
 
 // State Query Methods
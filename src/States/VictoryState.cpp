@@ -29,7 +29,7 @@ VictoryState::VictoryState(Game* game, StateMachine* machine,
 
 // State lifecycle - play victory sound and effects
 void VictoryState::onEnter() {
-    AudioManager::getInstance().playSound("level_up", AudioManager::AudioCategory::UI);
+    AudioManager::getInstance().playSound(SoundId::LevelUp, AudioManager::AudioCategory::UI);
 }
 
 // State lifecycle - no cleanup needed
@@ -53,7 +53,7 @@ void VictoryState::update(float dt) {
 }
 
 // Render victory screen with animated confetti
-void VictoryState::render(sf::RenderWindow& window) {
+void VictoryState::render(sf::RenderTarget& window) {
     window.draw(m_backgroundSprite);    // Background
     window.draw(m_statsText);           // Score statistics
     window.draw(m_tipText);             // Achievement messages
@@ -75,12 +75,12 @@ void VictoryState::render(sf::RenderWindow& window) {
 // Create and layout victory interface elements
 void VictoryState::setupUI() {
     auto& rm = ResourceManager::getInstance();
-    sf::Font& font = rm.getFont("bruce");
-    sf::Texture& bgTexture = rm.getTexture("level_bg.png");
-    sf::Texture& btnTexture = rm.getTexture("btn.png");
+    sf::Font& font = rm.getFont(FontId::Game);
+    sf::Texture& btnTexture = rm.getTexture(TextureId::Button);
 
     // Setup semi-transparent background
-    m_backgroundSprite.setTexture(bgTexture);
+    m_backgroundTexture = rm.acquireScaledTexture("level_bg.png");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
     m_backgroundSprite.setColor(sf::Color(255, 255, 255, 150));
 
     const float centerX = GameConstants::WINDOW_WIDTH / 2.f;
@@ -147,7 +147,7 @@ void VictoryState::setupUI() {
 
         // Add click sound and callback
         btn->setClickCallback([=]() {
-            AudioManager::getInstance().playSound("click");
+            AudioManager::getInstance().playSound(SoundId::Click);
             def.callback();
             });
 
@@ -3,322 +3,319 @@
 // ================================
 #include "Systems/AnimationSystem.h"
 #include "Managers/ResourceManager.h"
+#include "Graphics/AnimationClipTable.h"
 #include "Entities/SquadMembers/HeavyGunnerMember.h"
 #include "Entities/Robots/BasicRobot.h"
+#include <filesystem>
 #include <iostream>
 
+namespace {
+    const std::string ANIMATION_CONFIG_FILE = "animations.cfg";
+    const char* const ANIMATION_CACHE_EXTENSION = ".clipcache";
+}
+
 AnimationSystem& AnimationSystem::getInstance() {
     static AnimationSystem instance;
     return instance;
 }
 
+// Clips are interned once; later calls keep ids and clip addresses stable for live components
 void AnimationSystem::initialize() {
-    createGameAnimations();
+    if (!m_clips.empty()) return;
+
+    if (!loadAnimationFromFile(ANIMATION_CONFIG_FILE)) {
+        std::cerr << "No animations loaded from " << ANIMATION_CONFIG_FILE << std::endl;
+    }
+    m_upgradeClip = getAnimationId("Upgrade");
 }
 
 void AnimationSystem::shutdown() {
-    m_animations.clear();
-    m_entityComponents.clear();
+    m_components.clear();
+    m_denseToSlot.clear();
+    m_firedCallbacks.clear();
+    m_firedHandles.clear();
+    m_pendingUnregisters.clear();
+
+    // Outstanding handles must not resolve to components registered later
+    m_freeSlots.clear();
+    for (std::uint32_t i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i].alive) {
+            m_slots[i].alive = false;
+            ++m_slots[i].generation;
+        }
+        m_freeSlots.push_back(i);
+    }
+
+    m_clips.clear();
+    m_clipNames.clear();
+    m_clipIds.clear();
+    m_upgradeClip = INVALID_ANIMATION_ID;
 }
 
 void AnimationSystem::update(float dt) {
     updateComponents(dt * m_globalSpeed);
 }
 
+// Indexed loop over the components present at the start; anything registered
+// meanwhile waits for the next frame and removals wait for the pass to end
 void AnimationSystem::updateComponents(float dt) {
-    for (auto& [entity, component] : m_entityComponents) {
-        if (component) {
-            component->update(dt);
+    m_updating = true;
+    const size_t count = m_components.size();
+    for (size_t i = 0; i < count; ++i) {
+        const size_t firedBefore = m_firedCallbacks.size();
+        m_components[i].update(dt, m_firedCallbacks);
+
+        const std::uint32_t slotIndex = m_denseToSlot[i];
+        for (size_t fired = firedBefore; fired < m_firedCallbacks.size(); ++fired) {
+            m_firedHandles.push_back(AnimationHandle{ slotIndex, m_slots[slotIndex].generation });
         }
     }
-}
-
-bool AnimationSystem::loadAnimationFromFile(const std::string& filename) {
-    return false;
-}
-
-// MAIN METHOD: Now calls split methods
-void AnimationSystem::createGameAnimations() {
-    createRobotAnimations();
-    createSquadMemberAnimations();
-    createProjectileAnimations();
-    createCollectibleAnimations();
-    createEffectAnimations();
-}
-
-// ✅ UPDATED: Robot animations with new hit animations
-void AnimationSystem::createRobotAnimations() {
-    auto& rm = ResourceManager::getInstance();
-    // ===== BASIC ROBOT - UPDATED WITH HIT ANIMATION (CROPPED FRAME SIZES) =====
-    const int frameWidth = 129;
-    const int frameHeight = 124;
-    const int frameCount = 10;
-
-    // Walk
-    if (rm.hasTexture("RockRobot_Walk.png")) {
-        const auto& tex = rm.getTexture("RockRobot_Walk.png");
-        Animation anim(tex, frameWidth, frameHeight, frameCount, 2.0f);
-        createAnimation("BasicRobotWalk", anim);
-    }
-
-    // Death
-    if (rm.hasTexture("RobotRock_Dead.png")) {
-        const auto& tex = rm.getTexture("RobotRock_Dead.png");
-        Animation anim(tex, frameWidth, frameHeight, frameCount, 1.5f);
-        createAnimation("BasicRobotDead", anim);
-    }
+    m_updating = false;
 
-    // Hit
-    if (rm.hasTexture("RockRobot_Hit.png")) {
-        const auto& tex = rm.getTexture("RockRobot_Hit.png");
-        Animation anim(tex, frameWidth, frameHeight, frameCount, 2.0f);
-        createAnimation("BasicRobotHit", anim);
+    for (AnimationHandle handle : m_pendingUnregisters) {
+        removeComponent(handle);
     }
-
-
-    // ===== STEALTH ROBOT - UPDATED WITH NEW ANIMATIONS =====
-    const int sframeWidth = 198;
-    const int sframeHeight = 181;
-    const int sframeCount = 10;
-
-    // ✅ StealthRobot Walk Animation
-    if (rm.hasTexture("StealthRobot_Walk1.png")) {
-        const auto& tex = rm.getTexture("StealthRobot_Walk1.png");
-        Animation walkAnim(tex, sframeWidth, sframeHeight, sframeCount, 2.0f);
-        createAnimation("StealthRobotWalk", walkAnim);
-    }
-
-    //  StealthRobot Hit Animation 
-    if (rm.hasTexture("StealthRobot_Hit.png")) {
-        const auto& tex = rm.getTexture("StealthRobot_Hit.png");
-        Animation hitAnim(tex, tex.getSize().x / 10, tex.getSize().y, 10, 1.2f); // only 5 frames
-        createAnimation("StealthRobotHit", hitAnim);
-    }
-
-    //  StealthRobot Death Animation
-    if (rm.hasTexture("StealthRobot_Dead.png")) {
-        const auto& tex = rm.getTexture("StealthRobot_Dead.png");
-        Animation anim(tex, tex.getSize().x / 10, tex.getSize().y, 10, 1.2f);
-        createAnimation("StealthRobotDead", anim);
+    m_pendingUnregisters.clear();
+
+    // Moved out so the loop owns them while callbacks run
+    std::vector<AnimationComponent::AnimationCallback> callbacks;
+    std::vector<AnimationHandle> owners;
+    callbacks.swap(m_firedCallbacks);
+    owners.swap(m_firedHandles);
+    for (size_t i = 0; i < callbacks.size(); ++i) {
+        // An earlier callback may have removed this owner
+        if (resolve(owners[i])) {
+            callbacks[i]();
+        }
     }
-  
 
+    // Keep the capacity for the next frame
+    callbacks.clear();
+    owners.clear();
+    if (m_firedCallbacks.empty()) m_firedCallbacks.swap(callbacks);
+    if (m_firedHandles.empty()) m_firedHandles.swap(owners);
+}
 
-    // ===== FIRE ROBOT (UNCHANGED) =====
-    if (rm.hasTexture("fire_robot_walk.png")) {
-        const auto& tex = rm.getTexture("fire_robot_walk.png");
-        // 10 frames, dimensions 1059x91, each frame ~106x91
-        Animation walkAnim(tex, tex.getSize().x / 10, tex.getSize().y, 10, 2.0f);
-        createAnimation("FireRobotWalk", walkAnim);
-    }
+// Clips come from animations.cfg, compiled once into a binary table that
+// later startups memory-map. Returns false if no clip could be loaded.
+bool AnimationSystem::loadAnimationFromFile(const std::string& filename) {
+    std::string cacheFile = std::filesystem::path(filename).replace_extension(ANIMATION_CACHE_EXTENSION).string();
 
-    if (rm.hasTexture("fire_robot_death.png")) {
-        const auto& tex = rm.getTexture("fire_robot_death.png");
-        // 6 frames, dimensions 608x91, each frame ~101x91  
-        Animation deathAnim(tex, tex.getSize().x / 10, tex.getSize().y, 10, 1.2f);
-        createAnimation("FireRobotDeath", deathAnim);
+    AnimationClipTable table;
+    if (!table.load(filename, cacheFile)) {
+        return false;
     }
 
+    size_t loaded = 0;
+    for (size_t i = 0; i < table.getClipCount(); ++i) {
+        const auto& clip = table.getClip(i);
+        const char* name = table.getString(clip.nameOffset);
 
-    if (rm.hasTexture("fire_robot.png")) {
-        const auto& tex = rm.getTexture("fire_robot.png");
-        // Single static texture for when robot stops
-        Animation staticAnim(tex, tex.getSize().x, tex.getSize().y, 1, 1.5f);
-        createAnimation("FireRobotStatic", staticAnim);
+        if (createSheetAnimation(name, table.getString(clip.sheetOffset), clip.frameCount, clip.duration,
+            static_cast<std::uint8_t>(clip.flags), clip.frameWidth, clip.frameHeight, table.getFrameDurations(clip))) {
+            ++loaded;
+        }
+        else {
+            std::cerr << "Animation " << name << ": sheet " << table.getString(clip.sheetOffset) << " not loaded" << std::endl;
+        }
     }
+    return loaded > 0;
 }
 
-void AnimationSystem::createSquadMemberAnimations() {
+// Build an animation from the packed atlas when available, otherwise from the loose sheet.
+// frameWidth/frameHeight of 0 mean "sheet width / frameCount" and "sheet height".
+bool AnimationSystem::createSheetAnimation(const std::string& name, const std::string& sheet,
+    int frameCount, float duration, std::uint8_t flags, int frameWidth, int frameHeight,
+    const std::vector<float>& frameDurations) {
     auto& rm = ResourceManager::getInstance();
 
-    // ===== HEAVY GUNNER =====
-    if (rm.hasTexture("HeavyGunner_Idle.png")) {
-        const auto& tex = rm.getTexture("HeavyGunner_Idle.png");
-        // 717x130, 5 frames = 143.4x130 per frame
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 1.0f);
-        createAnimation("HeavyGunnerIdle", anim);
-    }
+    if (const AtlasRegion* region = rm.getAtlasRegion(sheet)) {
+        if (static_cast<int>(region->frames.size()) == frameCount) {
+            Animation clip(rm.getTexture(region->pageTexture), region->frames, duration);
+            clip.setFlags(flags);
+            if (!frameDurations.empty()) clip.setFrameDurations(frameDurations);
+            createAnimation(name, clip);
+            return true;
+        }
+        std::cerr << "Atlas frame count mismatch for " << sheet << ", using loose sheet" << std::endl;
 
-    if (rm.hasTexture("HeavyGunner_Shot.png")) {
-        const auto& tex = rm.getTexture("HeavyGunner_Shot.png");
-        // 717x130, 5 frames = 143.4x130 per frame
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 0.6f);
-        createAnimation("HeavyGunnerShoot", anim);
+        // Preloading skips sheets the atlas covers, so the loose one is not resident yet
+        if (!rm.hasTexture(sheet) && !rm.loadTexture(sheet, sheet)) {
+            std::cerr << "Could not load loose sheet " << sheet << std::endl;
+            return false;
+        }
     }
 
-    // HeavyGunner Death Animation
-    if (rm.hasTexture("HeavyGunner_Dead.png")) {
-        const auto& tex = rm.getTexture("HeavyGunner_Dead.png");
-        // 717x130, 5 frames = 143.4x130 per frame
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 0.5f);  // Longer duration for death
-        createAnimation("HeavyGunnerDead", anim);
+    if (!rm.hasTexture(sheet) && !rm.loadTexture(sheet, sheet)) {
+        return false;
     }
 
-    // ===== SNIPER =====
-    if (rm.hasTexture("ss_Idle.png")) {
-        const auto& tex = rm.getTexture("ss_Idle.png");
-        // Assuming 6 frames in one row
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 1.0f);
-        createAnimation("SniperIdle", anim);
-    }
+    const auto& tex = rm.getTexture(sheet);
+    int width = frameWidth > 0 ? frameWidth : static_cast<int>(tex.getSize().x) / frameCount;
+    int height = frameHeight > 0 ? frameHeight : static_cast<int>(tex.getSize().y);
+    Animation clip(tex, width, height, frameCount, duration);
+    clip.setFlags(flags);
+    if (!frameDurations.empty()) clip.setFrameDurations(frameDurations);
+    createAnimation(name, clip);
+    return true;
+}
 
-    if (rm.hasTexture("Sniper_Shot.png")) {
-        const auto& tex = rm.getTexture("Sniper_Shot.png");
-        // 755x154, 5 frames = 151x154 per frame
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 1.0f);
-        createAnimation("SniperShoot", anim);
+void AnimationSystem::queueRenderables() const {
+    for (const auto& component : m_components) {
+        component.queueDraw();
     }
+}
 
-    // Sniper Death Animation
-    if (rm.hasTexture("Sniper_Dead.png")) {
-        const auto& tex = rm.getTexture("Sniper_Dead.png");
-        // 755x154, 5 frames = 151x154 per frame
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 0.5f);  // Longer duration for death
-        createAnimation("SniperDead", anim);
+void AnimationSystem::updateEntityPosition(AnimationHandle handle, const sf::Vector2f& position) {
+    if (AnimationComponent* component = resolve(handle)) {
+        component->setPosition(position);
     }
+}
 
-    // ===== SHIELD BEARER =====
-    if (rm.hasTexture("ShieldBearer_Idle.png")) {
-        const auto& tex = rm.getTexture("ShieldBearer_Idle.png");
-        // Assuming similar format to others
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 1.0f);
-        createAnimation("ShieldBearerIdle", anim);
+AnimationId AnimationSystem::createAnimation(const std::string& name, const Animation& animation) {
+    auto it = m_clipIds.find(name);
+    if (it != m_clipIds.end()) {
+        m_clips[it->second] = std::make_unique<Animation>(animation);
+        return it->second;
     }
 
-    if (rm.hasTexture("ShieldBearer_Block.png")) {
-        const auto& tex = rm.getTexture("ShieldBearer_Block.png");
-        // Block animation (used as hit/defense animation)
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 1.0f);
-        createAnimation("ShieldBearerBlock", anim);
+    if (m_clips.size() >= INVALID_ANIMATION_ID) {
+        std::cerr << "Animation table full, cannot add " << name << std::endl;
+        return INVALID_ANIMATION_ID;
     }
 
-    // ShieldBearer Death Animation
-    if (rm.hasTexture("ShieldBearer_Dead.png")) {
-        const auto& tex = rm.getTexture("ShieldBearer_Dead.png");
-        // 615x124, 5 frames = 123x124 per frame
-        Animation anim(tex, tex.getSize().x / 5, tex.getSize().y, 5, 0.5f);  // Longer duration for death
-        createAnimation("ShieldBearerDead", anim);
-    }
+    AnimationId id = static_cast<AnimationId>(m_clips.size());
+    m_clips.push_back(std::make_unique<Animation>(animation));
+    m_clipNames.push_back(name);
+    m_clipIds[name] = id;
+    return id;
 }
 
-void AnimationSystem::createProjectileAnimations() {
-    auto& rm = ResourceManager::getInstance();
+AnimationId AnimationSystem::getAnimationId(const std::string& name) const {
+    auto it = m_clipIds.find(name);
+    return (it != m_clipIds.end()) ? it->second : INVALID_ANIMATION_ID;
 }
 
-// Collectible animations only
-void AnimationSystem::createCollectibleAnimations() {
-    auto& rm = ResourceManager::getInstance();
+const Animation* AnimationSystem::getAnimation(AnimationId id) const {
+    return (id < m_clips.size()) ? m_clips[id].get() : nullptr;
+}
 
-    // ===== COIN ANIMATION =====
-    if (rm.hasTexture("coin.png")) {
-        const auto& tex = rm.getTexture("coin.png");
-        int frameCount = 4;
-        int frameWidth = tex.getSize().x / frameCount;
-        int frameHeight = tex.getSize().y;
+const Animation* AnimationSystem::getAnimation(const std::string& name) const {
+    return getAnimation(getAnimationId(name));
+}
 
-        // Coin spinning animation - loops continuously
-        Animation coinAnim(tex, frameWidth, frameHeight, frameCount, 2.0f);
-        createAnimation("CoinSpin", coinAnim);
-    }
+const std::string& AnimationSystem::getAnimationName(AnimationId id) const {
+    static const std::string empty;
+    return (id < m_clipNames.size()) ? m_clipNames[id] : empty;
+}
 
-    // ===== HEALTH BAG ANIMATION =====
-    if (rm.hasTexture("HealthBag.png")) {
-        const auto& tex = rm.getTexture("HealthBag.png");
-        int frameCount = 5;
-        int frameWidth = tex.getSize().x / frameCount;
-        int frameHeight = tex.getSize().y;
+bool AnimationSystem::hasAnimation(const std::string& name) const {
+    return m_clipIds.find(name) != m_clipIds.end();
+}
 
-        // Health bag idle animation - loops continuously
-        Animation healthBagAnim(tex, frameWidth, frameHeight, frameCount, 2.0f);
-        createAnimation("HealthBag", healthBagAnim);
+// ================================
+// Component storage - dense array with generation-checked handles
+// ================================
+AnimationHandle AnimationSystem::addComponent(void* owner, RenderLayer layer) {
+    std::uint32_t slotIndex;
+    if (!m_freeSlots.empty()) {
+        slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        slotIndex = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
     }
-}
 
-// Effect animations only
-void AnimationSystem::createEffectAnimations() {
-    auto& rm = ResourceManager::getInstance();
+    ComponentSlot& slot = m_slots[slotIndex];
+    slot.denseIndex = static_cast<std::uint32_t>(m_components.size());
+    slot.alive = true;
 
-    // ===== EXPLOSION ANIMATION =====
-    if (rm.hasTexture("explosion.png")) {
-        const auto& tex = rm.getTexture("explosion.png");
-        int columns = 4;
-        int frameWidth = tex.getSize().x / columns;
-        int frameHeight = tex.getSize().y;
-        Animation anim(tex, frameWidth, frameHeight, columns, 0.4f);
-        createAnimation("Explosion", anim);
-    }
-}
+    m_components.emplace_back(owner);
+    m_components.back().setRenderLayer(layer);
+    m_denseToSlot.push_back(slotIndex);
 
-void AnimationSystem::render(sf::RenderWindow& window) {
-    for (const auto& [entity, component] : m_entityComponents) {
-        if (component) component->draw(window);
-    }
+    return AnimationHandle{ slotIndex, slot.generation };
 }
 
-void AnimationSystem::updateEntityPosition(void* entity, const sf::Vector2f& position) {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end() && it->second) {
-        it->second->setPosition(position);
-    }
+AnimationComponent* AnimationSystem::resolve(AnimationHandle handle) {
+    if (handle.index >= m_slots.size()) return nullptr;
+    const ComponentSlot& slot = m_slots[handle.index];
+    if (!slot.alive || slot.generation != handle.generation) return nullptr;
+    return &m_components[slot.denseIndex];
 }
 
-void AnimationSystem::createAnimation(const std::string& name, const Animation& animation) {
-    m_animations[name] = std::make_unique<Animation>(animation);
+const AnimationComponent* AnimationSystem::resolve(AnimationHandle handle) const {
+    return const_cast<AnimationSystem*>(this)->resolve(handle);
 }
 
-const Animation* AnimationSystem::getAnimation(const std::string& name) const {
-    auto it = m_animations.find(name);
-    return (it != m_animations.end()) ? it->second.get() : nullptr;
+AnimationHandle AnimationSystem::registerSquadMember(SquadMember* unit) {
+    return addComponent(unit, RenderLayer::Units);
 }
 
-bool AnimationSystem::hasAnimation(const std::string& name) const {
-    return m_animations.find(name) != m_animations.end();
+AnimationHandle AnimationSystem::registerRobot(Robot* robot) {
+    return addComponent(robot, RenderLayer::Units);
 }
 
-void AnimationSystem::registerSquadMember(SquadMember* unit) {
-    m_entityComponents[unit] = std::make_unique<AnimationComponent>(unit);
+AnimationHandle AnimationSystem::registerCollectible(Collectible* collectible) {
+    return addComponent(collectible, RenderLayer::Collectibles);
 }
 
-void AnimationSystem::registerRobot(Robot* robot) {
-    m_entityComponents[robot] = std::make_unique<AnimationComponent>(robot);
+AnimationHandle AnimationSystem::registerProjectile(Projectile* projectile) {
+    return addComponent(projectile, RenderLayer::Projectiles);
 }
 
-void AnimationSystem::registerCollectible(Collectible* collectible) {
-    m_entityComponents[collectible] = std::make_unique<AnimationComponent>(collectible);
+void AnimationSystem::unregisterEntity(AnimationHandle handle) {
+    if (m_updating) {
+        m_pendingUnregisters.push_back(handle);
+        return;
+    }
+    removeComponent(handle);
 }
 
-void AnimationSystem::registerProjectile(Projectile* projectile) {
-    m_entityComponents[projectile] = std::make_unique<AnimationComponent>(projectile);
-}
+// Swap-remove keeps the component array dense
+void AnimationSystem::removeComponent(AnimationHandle handle) {
+    if (!resolve(handle)) return;
 
-void AnimationSystem::unregisterEntity(void* entity) {
-    m_entityComponents.erase(entity);
-}
+    ComponentSlot& slot = m_slots[handle.index];
+    const std::uint32_t removed = slot.denseIndex;
+    const std::uint32_t last = static_cast<std::uint32_t>(m_components.size() - 1);
 
-void AnimationSystem::playAnimation(void* entity, const std::string& animationName) {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end()) {
-        const Animation* anim = getAnimation(animationName);
-        if (anim) {
-            it->second->play(*anim, animationName);
-        }
+    if (removed != last) {
+        m_components[removed] = std::move(m_components[last]);
+        m_denseToSlot[removed] = m_denseToSlot[last];
+        m_slots[m_denseToSlot[removed]].denseIndex = removed;
     }
+    m_components.pop_back();
+    m_denseToSlot.pop_back();
+
+    slot.alive = false;
+    ++slot.generation;
+    m_freeSlots.push_back(handle.index);
+}
+
+bool AnimationSystem::playAnimation(AnimationHandle handle, AnimationId id) {
+    AnimationComponent* component = resolve(handle);
+    const Animation* clip = getAnimation(id);
+    if (!component || !clip) return false;
+
+    component->play(*clip, id);
+    return true;
 }
 
 // Animation callback support
-void AnimationSystem::setAnimationCompleteCallback(void* entity, AnimationComponent::AnimationCallback callback) {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end() && it->second) {
-        it->second->setAnimationCompleteCallback(callback);
+void AnimationSystem::setAnimationCompleteCallback(AnimationHandle handle, AnimationComponent::AnimationCallback callback) {
+    if (AnimationComponent* component = resolve(handle)) {
+        component->setAnimationCompleteCallback(callback);
     }
 }
 
-void AnimationSystem::playDamageFlash(void* entity) {
+void AnimationSystem::playDamageFlash(AnimationHandle handle) {
     // Reserved for future use
 }
 
-void AnimationSystem::playUpgradeEffect(SquadMember* unit) {
-    playAnimation(unit, "Upgrade");
+void AnimationSystem::playUpgradeEffect(AnimationHandle handle) {
+    playAnimation(handle, m_upgradeClip);
 }
 
 void AnimationSystem::setGlobalSpeed(float speed) {
@@ -329,32 +326,24 @@ float AnimationSystem::getGlobalSpeed() const {
     return m_globalSpeed;
 }
 
-void AnimationSystem::pauseEntityAnimation(void* entity) {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end() && it->second) {
-        it->second->pause();
+void AnimationSystem::pauseEntityAnimation(AnimationHandle handle) {
+    if (AnimationComponent* component = resolve(handle)) {
+        component->pause();
     }
 }
 
-void AnimationSystem::resumeEntityAnimation(void* entity) {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end() && it->second) {
-        it->second->resume();
+void AnimationSystem::resumeEntityAnimation(AnimationHandle handle) {
+    if (AnimationComponent* component = resolve(handle)) {
+        component->resume();
     }
 }
 
-bool AnimationSystem::isEntityAnimationPaused(void* entity) const {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end() && it->second) {
-        return it->second->isPaused();
-    }
-    return false;
+bool AnimationSystem::isEntityAnimationPaused(AnimationHandle handle) const {
+    const AnimationComponent* component = resolve(handle);
+    return component && component->isPaused();
 }
 
-bool AnimationSystem::isEntityPlayingAnimation(void* entity, const std::string& animationName) const {
-    auto it = m_entityComponents.find(entity);
-    if (it != m_entityComponents.end() && it->second) {
-        return it->second->isPlayingAnimation(animationName);
-    }
-    return false;
-}
\ No newline at end of file
+bool AnimationSystem::isEntityPlayingAnimation(AnimationHandle handle, AnimationId id) const {
+    const AnimationComponent* component = resolve(handle);
+    return component && component->isPlayingAnimation(id);
+}
@@ -2,42 +2,145 @@
 // src/Systems/EventSystem.cpp - Implementation for your EventSystem
 // ================================
 #include "Systems/EventSystem.h"
+#include <fstream>
 #include <iostream>
 
+EventSystem::~EventSystem() {
+    discardIngress();
+}
+
 void EventSystem::processEvents() {
-    while (!m_eventQueue.empty()) {
-        auto& queuedEvent = m_eventQueue.front();
-
-        // Find handlers for this event type
-        auto it = m_handlers.find(queuedEvent.type);
-        if (it != m_handlers.end()) {
-            // Call all handlers for this event type
-            for (const auto& handler : it->second) {
-                handler(queuedEvent.event.get());
-            }
-        }
+    drainIngress();
+    ++m_dispatchDepth;
+
+    // Rounds repeat while handlers keep publishing (a destroyed robot drops a coin)
+    const bool tracing = m_tracing;
+    while (getQueuedEventCount() > 0) {
+        std::apply([tracing](auto&... channels) { (dispatchBatch(channels, tracing), ...); }, m_channels);
+    }
 
-        m_eventQueue.pop();
+    --m_dispatchDepth;
+    compactHandlers();
+    if (m_dispatchDepth == 0 && tracing) {
+        rollFrameStats();
     }
 }
 
-void EventSystem::clear() {
-    m_handlers.clear();
+void EventSystem::drainIngress() {
+    while (MpscNode* node = m_ingress.pop()) {
+        auto* ingress = static_cast<IngressNode*>(node);
+        ingress->deliver(this, ingress);
+    }
+}
 
-    // Clear the queue
-    while (!m_eventQueue.empty()) {
-        m_eventQueue.pop();
+void EventSystem::discardIngress() {
+    while (MpscNode* node = m_ingress.pop()) {
+        auto* ingress = static_cast<IngressNode*>(node);
+        ingress->deliver(nullptr, ingress);
     }
 }
 
+void EventSystem::compactHandlers() {
+    if (m_dispatchDepth > 0) return;
+
+    std::apply([](auto&... channels) {
+        ([](auto& channel) {
+            if (!channel.hasRemovedHandlers) return;
+            for (size_t i = 0; i < channel.handlers.size(); ) {
+                if (channel.handlers[i].handler) {
+                    ++i;
+                    continue;
+                }
+                channel.handlers[i] = std::move(channel.handlers.back());
+                channel.handlers.pop_back();
+            }
+            channel.hasRemovedHandlers = false;
+            }(channels), ...);
+        }, m_channels);
+}
+
+// Outstanding Subscription tokens become no-ops; their ids are never reused
+void EventSystem::clear() {
+    std::apply([](auto&... channels) {
+        ((channels.handlers.clear(), channels.queue.clear(), channels.hasRemovedHandlers = false), ...);
+        }, m_channels);
+    discardIngress();
+}
+
+void EventSystem::discardQueuedEvents() {
+    std::apply([](auto&... channels) { (channels.queue.clear(), ...); }, m_channels);
+    discardIngress();
+}
+
 int EventSystem::getHandlerCount() const {
-    int total = 0;
-    for (const auto& pair : m_handlers) {
-        total += static_cast<int>(pair.second.size());
-    }
-    return total;
+    return std::apply([](const auto&... channels) {
+        return (0 + ... + static_cast<int>(channels.handlers.size()));
+        }, m_channels);
 }
 
 int EventSystem::getQueuedEventCount() const {
-    return static_cast<int>(m_eventQueue.size());
-}
\ No newline at end of file
+    return std::apply([](const auto&... channels) {
+        return (0 + ... + static_cast<int>(channels.queue.size()));
+        }, m_channels);
+}
+
+// ================================
+// Tracing
+// ================================
+void EventSystem::setTracingEnabled(bool enabled) {
+    if (enabled && !m_tracing) {
+        resetStats();
+    }
+    m_tracing = enabled;
+}
+
+void EventSystem::rollFrameStats() {
+    std::apply([](auto&... channels) {
+        ([](auto& channel) {
+            EventTypeStats& stats = channel.stats;
+            auto& frame = channel.frame;
+
+            stats.published += frame.published;
+            stats.handlersInvoked += frame.handlersInvoked;
+            stats.handlerMs += frame.handlerMs;
+            if (frame.highWater > stats.highWaterMark) stats.highWaterMark = frame.highWater;
+
+            stats.framePublished = frame.published;
+            stats.frameHandlersInvoked = frame.handlersInvoked;
+            stats.frameHandlerMs = static_cast<float>(frame.handlerMs);
+            stats.frameHighWater = frame.highWater;
+            frame = {};
+            }(channels), ...);
+        }, m_channels);
+}
+
+std::vector<EventTypeStats> EventSystem::getEventStats() const {
+    std::vector<EventTypeStats> result;
+    std::apply([&result](const auto&... channels) { (result.push_back(channels.stats), ...); }, m_channels);
+    return result;
+}
+
+bool EventSystem::exportStatsCsv(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Could not write event stats to " << filename << std::endl;
+        return false;
+    }
+
+    file << "event,published,handlers_invoked,handler_ms,avg_handler_us,high_water,"
+        << "frame_published,frame_handlers_invoked,frame_handler_ms,frame_high_water\n";
+    for (const auto& stats : getEventStats()) {
+        double averageUs = stats.published > 0 ? stats.handlerMs * 1000.0 / static_cast<double>(stats.published) : 0.0;
+        file << stats.name << ',' << stats.published << ',' << stats.handlersInvoked << ','
+            << stats.handlerMs << ',' << averageUs << ',' << stats.highWaterMark << ','
+            << stats.framePublished << ',' << stats.frameHandlersInvoked << ','
+            << stats.frameHandlerMs << ',' << stats.frameHighWater << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+void EventSystem::resetStats() {
+    std::apply([](auto&... channels) {
+        ((channels.stats = EventTypeStats{ channels.stats.name }, channels.frame = {}), ...);
+        }, m_channels);
+}
@@ -38,7 +38,7 @@ void Button::update(float dt) {
     m_pressTimer.update(dt);
 }
 
-void Button::draw(sf::RenderWindow& window) const {
+void Button::draw(sf::RenderTarget& window) const {
     if (m_style.enableGlow && m_currentGlow > 0) {
         renderGlow(window);
     }
@@ -373,7 +373,7 @@ bool Button::containsPoint(const sf::Vector2f& point) const {
 
 void Button::playHoverSound() {
     try {
-        AudioManager::getInstance().playSound("button_hover", AudioManager::AudioCategory::UI, 0.3f);
+        AudioManager::getInstance().playSound(SoundId::ButtonHover, AudioManager::AudioCategory::UI, 0.3f);
     }
     catch (...) {
         // Sound not available, continue silently
@@ -382,14 +382,14 @@ void Button::playHoverSound() {
 
 void Button::playClickSound() {
     try {
-        AudioManager::getInstance().playSound("click", AudioManager::AudioCategory::UI, 0.5f);
+        AudioManager::getInstance().playSound(SoundId::Click, AudioManager::AudioCategory::UI, 0.5f);
     }
     catch (...) {
         // Sound not available, continue silently
     }
 }
 
-void Button::renderBackground(sf::RenderWindow& window) const {
+void Button::renderBackground(sf::RenderTarget& window) const {
     // Apply scale transformation
     sf::Transform transform;
     sf::Vector2f center = m_position + m_size * 0.5f;
@@ -400,7 +400,7 @@ void Button::renderBackground(sf::RenderWindow& window) const {
     window.draw(m_background, transform);
 }
 
-void Button::renderGlow(sf::RenderWindow& window) const {
+void Button::renderGlow(sf::RenderTarget& window) const {
     if (m_currentGlow <= 0) return;
 
     sf::Color glowColor = m_style.hoverColor;
@@ -420,7 +420,7 @@ void Button::renderGlow(sf::RenderWindow& window) const {
     window.draw(glow, transform);
 }
 
-void Button::renderText(sf::RenderWindow& window) const {
+void Button::renderText(sf::RenderTarget& window) const {
     if (m_text.empty()) return;
 
     sf::Text textCopy = m_textObject;
@@ -438,7 +438,7 @@ void Button::renderText(sf::RenderWindow& window) const {
 }
 
 
-void Button::renderTexture(sf::RenderWindow& window) const {
+void Button::renderTexture(sf::RenderTarget& window) const {
     if (!m_useTexture) return;
 
     sf::Sprite spriteCopy = m_sprite;
@@ -0,0 +1,71 @@
+// ================================
+// src/UI/EventStatsOverlay.cpp
+// ================================
+#include "UI/EventStatsOverlay.h"
+#include "Systems/EventSystem.h"
+#include "Managers/ResourceManager.h"
+#include <cstdio>
+#include <iostream>
+
+EventStatsOverlay::EventStatsOverlay() {
+    m_text.setFont(ResourceManager::getInstance().getFont(FontId::Ui));
+    m_text.setCharacterSize(14);
+    m_text.setFillColor(sf::Color::White);
+    m_text.setPosition(16.f, 16.f);
+
+    m_background.setFillColor(sf::Color(0, 0, 0, 170));
+    m_background.setPosition(8.f, 8.f);
+}
+
+bool EventStatsOverlay::handleEvent(const sf::Event& event) {
+    if (event.type != sf::Event::KeyPressed) return false;
+
+    auto& events = EventSystem::getInstance();
+    if (event.key.code == sf::Keyboard::F3) {
+        m_visible = !m_visible;
+        events.setTracingEnabled(m_visible);             // Counters only cost time while shown
+        if (m_visible) refreshText();
+        return true;
+    }
+    if (event.key.code == sf::Keyboard::F4 && events.isTracingEnabled()) {
+        if (events.exportStatsCsv(CSV_FILE)) {
+            std::cout << "Event stats written to " << CSV_FILE << std::endl;
+        }
+        return true;
+    }
+    return false;
+}
+
+void EventStatsOverlay::draw(sf::RenderTarget& target) {
+    if (!m_visible) return;
+
+    if (m_refreshClock.getElapsedTime().asSeconds() >= REFRESH_INTERVAL) {
+        refreshText();
+    }
+
+    // Overlay is placed in screen space regardless of the state's view
+    sf::View previousView = target.getView();
+    target.setView(target.getDefaultView());
+    target.draw(m_background);
+    target.draw(m_text);
+    target.setView(previousView);
+}
+
+void EventStatsOverlay::refreshText() {
+    m_refreshClock.restart();
+
+    std::string table = "EVENTS (last frame / total)   F4: export CSV\n";
+    char line[160];
+    for (const auto& stats : EventSystem::getInstance().getEventStats()) {
+        if (stats.published == 0 && stats.framePublished == 0) continue;
+        std::snprintf(line, sizeof(line), "%-18s pub %3u/%-7llu calls %3u  %6.3f ms  %8.1f ms  hw %3zu/%zu\n",
+            stats.name, stats.framePublished, static_cast<unsigned long long>(stats.published),
+            stats.frameHandlersInvoked, stats.frameHandlerMs, stats.handlerMs,
+            stats.frameHighWater, stats.highWaterMark);
+        table += line;
+    }
+    m_text.setString(table);
+
+    sf::FloatRect bounds = m_text.getLocalBounds();
+    m_background.setSize(sf::Vector2f(bounds.width + 24.f, bounds.height + 24.f));
+}
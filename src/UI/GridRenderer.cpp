@@ -13,10 +13,10 @@ void GridRenderer::update(float dt) {
     // No-op - grid is static
 }
 
-void GridRenderer::draw(sf::RenderWindow& window) const {
+void GridRenderer::draw(sf::RenderTarget& target) const {
     // Always draw placement slots using texture
     auto& rm = ResourceManager::getInstance();
-    sf::Texture& placementTexture = rm.getTexture("placing_slot.png");
+    sf::Texture& placementTexture = rm.getTexture(TextureId::PlacingSlot);
 
     for (int lane = 0; lane < m_gridHeight; ++lane) {
         for (int gridX = 0; gridX < m_gridWidth; ++gridX) {
@@ -35,7 +35,7 @@ void GridRenderer::draw(sf::RenderWindow& window) const {
             slot.setScale(0.12f, 0.08f);
             slot.setColor(sf::Color(255, 255, 255, 200)); // Always visible
 
-            window.draw(slot);
+            target.draw(slot);
         }
     }
 }
@@ -67,6 +67,7 @@ bool GridRenderer::isValidGridPosition(int gridX, int lane) const {
 void GridRenderer::setGridSize(int width, int height) {
     m_gridWidth = width;
     m_gridHeight = height;
+    ++m_revision;
 }
 
 sf::Vector2i GridRenderer::getGridSize() const {
@@ -75,13 +76,16 @@ sf::Vector2i GridRenderer::getGridSize() const {
 
 void GridRenderer::setGridOffset(const sf::Vector2f& offset) {
     m_gridOffset = offset;
+    ++m_revision;
 }
 
 void GridRenderer::setCellSize(const sf::Vector2f& cellSize) {
     m_cellSize = cellSize;
+    ++m_revision;
 }
 
 // Block/unblock cells
+// Blocked cells share the slot look, so they don't bump the revision (no re-bake)
 void GridRenderer::blockCell(const sf::Vector2i& gridPos) {
     m_blockedCells.insert(gridPos);
 }
@@ -11,7 +11,7 @@
 void HUD::setupUI() {
     // Initialize UI elements here when you're ready to implement visuals
 
-    m_healthPackCountText.setFont(ResourceManager::getInstance().getFont("DejaVuSans.ttf"));
+    m_healthPackCountText.setFont(ResourceManager::getInstance().getFont(FontId::Ui));
     m_healthPackCountText.setCharacterSize(20);
     m_healthPackCountText.setFillColor(sf::Color::White);
     m_healthPackCountText.setStyle(sf::Text::Bold);
@@ -28,7 +28,7 @@ void HUD::update(float dt) {
     updateRangeIndicators(dt);
 }
 
-void HUD::draw(sf::RenderWindow& window) const {
+void HUD::draw(sf::RenderTarget& window) const {
     // Draw UI elements
     renderUnitInfo(window);
     renderVisualFeedback(window);
@@ -201,11 +201,11 @@ void HUD::onUnitButtonClicked(GameTypes::SquadMemberType type) {
     setSelectedUnitType(type);
 }
 
-void HUD::renderUnitInfo(sf::RenderWindow& window) const {
+void HUD::renderUnitInfo(sf::RenderTarget& window) const {
     // TODO: Implement unit info rendering
 }
 
-void HUD::renderVisualFeedback(sf::RenderWindow& window) const {
+void HUD::renderVisualFeedback(sf::RenderTarget& window) const {
     if (m_selectedUnit) {
         window.draw(m_unitHighlight);
     }
@@ -215,7 +215,7 @@ void HUD::renderVisualFeedback(sf::RenderWindow& window) const {
     }
 }
 
-void HUD::renderRangeIndicators(sf::RenderWindow& window) const {
+void HUD::renderRangeIndicators(sf::RenderTarget& window) const {
     if (m_showRangeIndicators) {
         for (const auto& [unit, indicator] : m_unitRangeIndicators) {
             window.draw(indicator);
@@ -223,7 +223,7 @@ void HUD::renderRangeIndicators(sf::RenderWindow& window) const {
     }
 }
 
-void HUD::renderTargetingVisualization(sf::RenderWindow& window) const {
+void HUD::renderTargetingVisualization(sf::RenderTarget& window) const {
     if (m_showTargetingLine) {
         window.draw(m_targetingLine, 2, sf::Lines);
     }
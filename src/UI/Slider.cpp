@@ -46,7 +46,7 @@ void Slider::handleEvent(const sf::Event& event) {
 
 void Slider::update(float) {}
 
-void Slider::render(sf::RenderWindow& window) {
+void Slider::render(sf::RenderTarget& window) {
     window.draw(m_track);
     window.draw(m_knob);
     window.draw(m_label);
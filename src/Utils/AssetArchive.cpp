@@ -0,0 +1,95 @@
+// ================================
+// src/Utils/AssetArchive.cpp
+// ================================
+#include "Utils/AssetArchive.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+using namespace AssetArchiveFormat;
+
+AssetArchive& AssetArchive::getInstance() {
+    static AssetArchive instance;
+    return instance;
+}
+
+bool AssetArchive::mount(const std::string& filename) {
+    if (isMounted()) {
+        std::cerr << "Asset archive already mounted, ignoring " << filename << std::endl;
+        return false;
+    }
+    if (!m_mapping.open(filename)) {
+        return false;
+    }
+
+    const std::uint8_t* base = m_mapping.data();
+    m_header = reinterpret_cast<const Header*>(base);
+    m_entries = reinterpret_cast<const Entry*>(base + sizeof(Header));
+
+    if (!validate()) {
+        std::cerr << "Asset archive " << filename << " is invalid, using loose files" << std::endl;
+        m_mapping.close();
+        m_header = nullptr;
+        m_entries = nullptr;
+        return false;
+    }
+
+    m_names = reinterpret_cast<const char*>(m_entries + m_header->entryCount);
+    return true;
+}
+
+size_t AssetArchive::getEntryCount() const {
+    return m_header ? m_header->entryCount : 0;
+}
+
+// Entries are sorted by name, so lookup is a binary search over the mapped index
+AssetArchive::View AssetArchive::find(const std::string& name) const {
+    if (!isMounted()) return View();
+
+    const Entry* first = m_entries;
+    const Entry* last = m_entries + m_header->entryCount;
+    const Entry* it = std::lower_bound(first, last, name, [this](const Entry& entry, const std::string& key) {
+        return std::strcmp(m_names + entry.nameOffset, key.c_str()) < 0;
+    });
+    if (it == last || name != m_names + it->nameOffset) {
+        return View();
+    }
+
+    View view;
+    view.data = m_mapping.data() + it->offset;
+    view.size = static_cast<size_t>(it->size);
+    view.type = it->type;
+    return view;
+}
+
+bool AssetArchive::validate() const {
+    const size_t size = m_mapping.size();
+    if (size < sizeof(Header) ||
+        std::memcmp(m_header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        m_header->version != VERSION) {
+        return false;
+    }
+
+    const std::uint64_t indexEnd = sizeof(Header) +
+        static_cast<std::uint64_t>(m_header->entryCount) * sizeof(Entry) + m_header->nameBytes;
+    if (m_header->nameBytes == 0 || indexEnd > size) {
+        return false;
+    }
+
+    const char* names = reinterpret_cast<const char*>(m_entries + m_header->entryCount);
+    if (names[m_header->nameBytes - 1] != '\0') {
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < m_header->entryCount; ++i) {
+        const Entry& entry = m_entries[i];
+        if (entry.nameOffset >= m_header->nameBytes ||
+            entry.offset < indexEnd || entry.offset > size || entry.size > size - entry.offset) {
+            return false;
+        }
+        if (i > 0 && std::strcmp(names + m_entries[i - 1].nameOffset, names + entry.nameOffset) >= 0) {
+            return false;   // Must be strictly sorted for binary search
+        }
+    }
+    return true;
+}
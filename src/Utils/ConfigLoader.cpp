@@ -2,6 +2,7 @@
 // src/Utils/ConfigLoader.cpp
 // ================================
 #include "Utils/ConfigLoader.h"
+#include "Managers/ResourceManager.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -18,6 +19,44 @@ const std::vector<std::string> ConfigLoader::REQUIRED_CONFIG_FILES = {
     "collectibles.cfg"
 };
 
+namespace {
+    // Section names and fallbacks per type, in enum order
+    struct RobotDefaults {
+        const char* section;
+        RobotArchetype archetype;
+    };
+    const RobotDefaults ROBOT_DEFAULTS[ROBOT_TYPE_COUNT] = {
+        { "BasicRobot",   { 100, 50.0f, 25, 30, 100.0f, 25, 0.0f } },
+        { "FireRobot",    {  80, 40.0f,  0, 50, 200.0f,  0, 2.0f } },
+        { "StealthRobot", {  70, 60.0f, 40, 35, 100.0f, 40, 0.0f } }
+    };
+
+    struct UnitDefaults {
+        const char* section;
+        UnitArchetype archetype;
+    };
+    const UnitDefaults UNIT_DEFAULTS[UNIT_TYPE_COUNT] = {
+        { "HeavyGunner",  { 40, 200.0f, 100, 1.5f } },
+        { "Sniper",       { 40, 200.0f, 100, 2.5f } },
+        { "ShieldBearer", { 40, 200.0f, 100, 0.0f } }
+    };
+
+    struct ProjectileDefaults {
+        const char* section;                             // Null: not configurable
+        ProjectileArchetype archetype;
+    };
+    const ProjectileDefaults PROJECTILE_DEFAULTS[PROJECTILE_TYPE_COUNT] = {
+        { "SquadBullet",  {  400.0f, "bullet.png",       TextureId::Invalid, 0.03f, {  25.0f,   0.0f }, 300.0f, 25 } },
+        { "SniperBullet", {  600.0f, "SniperBullet.png", TextureId::Invalid, 0.06f, {  25.0f,   0.0f }, 350.0f, 40 } },
+        { nullptr,        {    0.0f, "",                 TextureId::Invalid, 0.0f,  {  25.0f,   0.0f },   0.0f, 25 } },
+        { "RobotBullet",  { -400.0f, "robot_bullet.png", TextureId::Invalid, 0.04f, { -30.0f, -50.0f }, 800.0f, 35 } }
+    };
+}
+
+ConfigLoader::ConfigLoader() {
+    compileArchetypes();
+}
+
 ConfigLoader& ConfigLoader::getInstance() {
     static ConfigLoader instance;
     return instance;
@@ -28,6 +67,7 @@ bool ConfigLoader::initializeAllConfigs() {
     clearError();
     m_loadedConfigs.clear();
     m_config.clear();
+    compileArchetypes();
 
     return m_initialized;
 }
@@ -51,48 +91,12 @@ std::vector<std::string> ConfigLoader::getMissingConfigs() const {
 }
 
 int ConfigLoader::getProjectileDamage(GameTypes::ProjectileType type) const {
-    std::string projectileSection;
-
-    switch (type) {
-    case GameTypes::ProjectileType::Bullet:
-        projectileSection = "SquadBullet";
-        break;
-    case GameTypes::ProjectileType::SniperBullet:
-        projectileSection = "SniperBullet";
-        break;
-    case GameTypes::ProjectileType::RobotBullet:
-        projectileSection = "RobotBullet";
-        break;
-    default:
-        projectileSection = "SquadBullet";
-        break;
-    }
-
-    int damage = getInt(projectileSection, "damage", 25);
-
-    return damage;
+    return getProjectileArchetype(type).damage;
 }
 
 
 float ConfigLoader::getProjectileSpeed(GameTypes::ProjectileType type) const {
-    std::string projectileSection;
-
-    switch (type) {
-    case GameTypes::ProjectileType::Bullet:
-        projectileSection = "SquadBullet";
-        break;
-    case GameTypes::ProjectileType::SniperBullet:
-        projectileSection = "SniperBullet";
-        break;
-    case GameTypes::ProjectileType::RobotBullet:
-        projectileSection = "RobotBullet";
-        break;
-    default:
-        projectileSection = "SquadBullet";
-        break;
-    }
-
-    return getFloat(projectileSection, "speed", 400.0f);
+    return getProjectileArchetype(type).speed;
 }
 
 // Physics configuration getters
@@ -133,16 +137,7 @@ ConfigLoader::ProjectileConfig ConfigLoader::loadProjectileConfig(const std::str
     config.maxRange = getFloat(projectileName, "maxRange", 300.0f);
     config.damage = getInt(projectileName, "damage", 25);
 
-    // Parse spawn offset (format: "x,y")
-    std::string offsetStr = getString(projectileName, "spawnOffset", "50,-14");
-    size_t commaPos = offsetStr.find(',');
-    if (commaPos != std::string::npos) {
-        config.spawnOffset.x = std::stof(offsetStr.substr(0, commaPos));
-        config.spawnOffset.y = std::stof(offsetStr.substr(commaPos + 1));
-    }
-    else {
-        config.spawnOffset = sf::Vector2f(50.0f, -14.0f);
-    }
+    config.spawnOffset = getVector(projectileName, "spawnOffset", sf::Vector2f(50.0f, -14.0f)); // "x,y"
 
     return config;
 }
@@ -190,6 +185,7 @@ bool ConfigLoader::loadFromFile(const std::string& filename) {
 
 void ConfigLoader::clearConfig() {
     m_config.clear();
+    compileArchetypes();
     m_loadedConfigs.clear();
     m_initialized = false;
     clearError();
@@ -249,41 +245,11 @@ bool ConfigLoader::hasValue(const std::string& section, const std::string& key)
 }
 
 int ConfigLoader::getUnitCost(GameTypes::SquadMemberType type) const {
-    std::string unitName;
-    switch (type) {
-    case GameTypes::SquadMemberType::HeavyGunner:
-        unitName = "HeavyGunner";
-        break;
-    case GameTypes::SquadMemberType::Sniper:
-        unitName = "Sniper";
-        break;
-    case GameTypes::SquadMemberType::ShieldBearer:
-        unitName = "ShieldBearer";
-        break;
-    default:
-        unitName = "HeavyGunner";
-        break;
-    }
-    return getInt(unitName, "cost", 100);
+    return getUnitArchetype(type).cost;
 }
 
 int ConfigLoader::getRobotReward(GameTypes::RobotType type) const {
-    std::string robotSection;
-    switch (type) {
-    case GameTypes::RobotType::Basic:
-        robotSection = "BasicRobot";
-        break;
-    case GameTypes::RobotType::Fire:
-        robotSection = "FireRobot";
-        break;
-    case GameTypes::RobotType::Stealth:
-        robotSection = "StealthRobot";
-        break;
-    default:
-        robotSection = "BasicRobot";
-        break;
-    }
-    return getInt(robotSection, "reward", 30);
+    return getRobotArchetype(type).reward;
 }
 
 float ConfigLoader::getDropRate(GameTypes::RobotType robotType, const std::string& dropType) const {
@@ -367,6 +333,8 @@ ConfigLoader::GameConfig ConfigLoader::loadGameConfig() const {
     config.baseHealth = getInt("Gameplay", "baseHealth", 100);
     config.numLanes = getInt("Gameplay", "numLanes", 3);
 
+    config.textureBudgetMB = getInt("Memory", "textureBudgetMB", 0);
+
     return config;
 }
 
@@ -379,6 +347,81 @@ bool ConfigLoader::hasErrors() const {
 }
 
 bool ConfigLoader::parseINI(const std::string& content) {
+    parseINIContent(content, m_config);
+    compileArchetypes();
+    return true;
+}
+
+// A few dozen lookups per load, instead of per spawn and per shot
+void ConfigLoader::compileArchetypes() {
+    for (size_t i = 0; i < ROBOT_TYPE_COUNT; ++i) {
+        const RobotDefaults& defaults = ROBOT_DEFAULTS[i];
+        RobotArchetype& robot = m_robotArchetypes[i];
+        robot.health = getInt(defaults.section, "health", defaults.archetype.health);
+        robot.speed = getFloat(defaults.section, "speed", defaults.archetype.speed);
+        robot.damage = getInt(defaults.section, "damage", defaults.archetype.damage);
+        robot.reward = getInt(defaults.section, "reward", defaults.archetype.reward);
+        robot.attackRange = getFloat(defaults.section, "attackRange", defaults.archetype.attackRange);
+        robot.meleeAttackDamage = getInt(defaults.section, "meleeAttackDamage", robot.damage);
+        robot.bulletCooldown = getFloat(defaults.section, "bulletCooldown", defaults.archetype.bulletCooldown);
+    }
+
+    for (size_t i = 0; i < UNIT_TYPE_COUNT; ++i) {
+        const UnitDefaults& defaults = UNIT_DEFAULTS[i];
+        UnitArchetype& unit = m_unitArchetypes[i];
+        unit.cost = getInt(defaults.section, "cost", defaults.archetype.cost);
+        unit.range = getFloat(defaults.section, "range", defaults.archetype.range);
+        unit.health = getInt(defaults.section, "health", defaults.archetype.health);
+        unit.attackSpeed = getFloat(defaults.section, "attackSpeed", defaults.archetype.attackSpeed);
+    }
+
+    auto& resources = ResourceManager::getInstance();
+    for (size_t i = 0; i < PROJECTILE_TYPE_COUNT; ++i) {
+        const ProjectileDefaults& defaults = PROJECTILE_DEFAULTS[i];
+        ProjectileArchetype& projectile = m_projectileArchetypes[i];
+        projectile = defaults.archetype;
+        if (defaults.section) {
+            projectile.speed = getFloat(defaults.section, "speed", projectile.speed);
+            projectile.textureFile = getString(defaults.section, "texture", projectile.textureFile);
+            projectile.scale = getFloat(defaults.section, "scale", projectile.scale);
+            projectile.spawnOffset = getVector(defaults.section, "spawnOffset", projectile.spawnOffset);
+            projectile.maxRange = getFloat(defaults.section, "maxRange", projectile.maxRange);
+            projectile.damage = getInt(defaults.section, "damage", projectile.damage);
+        }
+        if (!projectile.textureFile.empty()) {
+            projectile.texture = resources.getTextureId(projectile.textureFile);   // Interned only, not loaded
+        }
+    }
+}
+
+sf::Vector2f ConfigLoader::getVector(const std::string& section, const std::string& key, const sf::Vector2f& defaultValue) const {
+    std::string value = getString(section, key, "");
+    size_t comma = value.find(',');
+    if (comma == std::string::npos) {
+        return defaultValue;
+    }
+    try {
+        return sf::Vector2f(std::stof(value.substr(0, comma)), std::stof(value.substr(comma + 1)));
+    }
+    catch (const std::exception&) {
+        return defaultValue;
+    }
+}
+
+const RobotArchetype& ConfigLoader::getRobotArchetype(GameTypes::RobotType type) const {
+    return m_robotArchetypes[static_cast<size_t>(type)];
+}
+
+const UnitArchetype& ConfigLoader::getUnitArchetype(GameTypes::SquadMemberType type) const {
+    return m_unitArchetypes[static_cast<size_t>(type)];
+}
+
+const ProjectileArchetype& ConfigLoader::getProjectileArchetype(GameTypes::ProjectileType type) const {
+    return m_projectileArchetypes[static_cast<size_t>(type)];
+}
+
+// Stateless so the hot-reload watcher thread can parse without touching m_config
+void ConfigLoader::parseINIContent(const std::string& content, Sections& sections) {
     std::istringstream stream(content);
     std::string line;
     std::string currentSection;
@@ -399,14 +442,30 @@ bool ConfigLoader::parseINI(const std::string& content) {
         if (equalPos != std::string::npos && !currentSection.empty()) {
             std::string key = trim(line.substr(0, equalPos));
             std::string value = trim(line.substr(equalPos + 1));
-            m_config[currentSection][key] = value;
+            sections[currentSection][key] = value;
         }
     }
+}
 
+bool ConfigLoader::parseFile(const std::string& filename, Sections& sections) {
+    std::string content = readFileContent(filename);
+    if (content.empty()) {
+        return false;
+    }
+    parseINIContent(content, sections);
     return true;
 }
 
-std::string ConfigLoader::readFileContent(const std::string& filename) const {
+void ConfigLoader::mergeSections(const Sections& sections) {
+    for (const auto& [section, values] : sections) {
+        for (const auto& [key, value] : values) {
+            m_config[section][key] = value;
+        }
+    }
+    compileArchetypes();
+}
+
+std::string ConfigLoader::readFileContent(const std::string& filename) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         return "";
@@ -417,7 +476,7 @@ std::string ConfigLoader::readFileContent(const std::string& filename) const {
     return content.str();
 }
 
-std::string ConfigLoader::trim(const std::string& str) const {
+std::string ConfigLoader::trim(const std::string& str) {
     size_t start = str.find_first_not_of(" \t\r\n");
     if (start == std::string::npos) return "";
 
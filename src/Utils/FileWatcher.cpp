@@ -0,0 +1,163 @@
+// ================================
+// src/Utils/FileWatcher.cpp
+// ================================
+#include "Utils/FileWatcher.h"
+#include <iostream>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Long enough to cover an editor's save sequence, short enough to feel instant
+    const auto SETTLE_TIME = std::chrono::milliseconds(100);
+    const int WAIT_TIMEOUT_MS = 50;                      // Bounds how long stop() waits
+#ifndef __linux__
+    const auto POLL_INTERVAL = std::chrono::milliseconds(250);
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+bool FileWatcher::start(const std::vector<std::string>& directories, ChangeCallback callback) {
+    if (isRunning()) return false;
+
+    m_directories = directories;
+    m_callback = std::move(callback);
+    m_pending.clear();
+    m_stopping = false;
+
+#ifdef __linux__
+    if (!openInotify()) {
+        return false;
+    }
+#else
+    m_writeTimes.clear();
+    scanDirectories();                                   // Baseline; only later writes are reported
+    m_pending.clear();
+    m_nextScan = Clock::now() + POLL_INTERVAL;
+#endif
+
+    m_thread = std::thread(&FileWatcher::watchLoop, this);
+    return true;
+}
+
+void FileWatcher::stop() {
+    m_stopping = true;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+#ifdef __linux__
+    if (m_inotifyFd >= 0) {
+        ::close(m_inotifyFd);                            // Also drops every watch
+        m_inotifyFd = -1;
+    }
+    m_watchDirectories.clear();
+#endif
+}
+
+void FileWatcher::watchLoop() {
+    while (!m_stopping) {
+#ifdef __linux__
+        pollfd descriptor{ m_inotifyFd, POLLIN, 0 };
+        if (::poll(&descriptor, 1, WAIT_TIMEOUT_MS) > 0 && (descriptor.revents & POLLIN)) {
+            readInotifyEvents();
+        }
+#else
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_TIMEOUT_MS));
+        if (Clock::now() >= m_nextScan) {
+            scanDirectories();
+            m_nextScan = Clock::now() + POLL_INTERVAL;
+        }
+#endif
+        reportSettled();
+    }
+}
+
+void FileWatcher::markChanged(const std::filesystem::path& path) {
+    m_pending[path.string()] = Clock::now();             // Each write restarts the settle timer
+}
+
+void FileWatcher::reportSettled() {
+    const auto now = Clock::now();
+    for (auto it = m_pending.begin(); it != m_pending.end(); ) {
+        if (now - it->second >= SETTLE_TIME) {
+            std::filesystem::path path = it->first;
+            it = m_pending.erase(it);
+            if (m_callback) m_callback(path);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+#ifdef __linux__
+bool FileWatcher::openInotify() {
+    m_inotifyFd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotifyFd < 0) {
+        std::cerr << "FileWatcher: inotify unavailable" << std::endl;
+        return false;
+    }
+
+    // CLOSE_WRITE for in-place saves, MOVED_TO for editors that save via rename
+    for (const auto& directory : m_directories) {
+        int watch = ::inotify_add_watch(m_inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watch < 0) {
+            std::cerr << "FileWatcher: cannot watch " << directory << std::endl;
+            continue;
+        }
+        m_watchDirectories[watch] = directory;
+    }
+
+    if (m_watchDirectories.empty()) {
+        ::close(m_inotifyFd);
+        m_inotifyFd = -1;
+        return false;
+    }
+    return true;
+}
+
+void FileWatcher::readInotifyEvents() {
+    alignas(inotify_event) char buffer[4096];
+
+    for (;;) {
+        ssize_t length = ::read(m_inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) return;                         // EAGAIN: drained
+
+        for (char* cursor = buffer; cursor < buffer + length; ) {
+            const auto* event = reinterpret_cast<const inotify_event*>(cursor);
+            cursor += sizeof(inotify_event) + event->len;
+
+            if (event->len == 0 || (event->mask & IN_ISDIR)) continue;
+            auto directory = m_watchDirectories.find(event->wd);
+            if (directory != m_watchDirectories.end()) {
+                markChanged(directory->second / event->name);
+            }
+        }
+    }
+}
+#else
+void FileWatcher::scanDirectories() {
+    std::error_code error;
+    for (const auto& directory : m_directories) {
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            if (!entry.is_regular_file(error)) continue;
+
+            auto writeTime = entry.last_write_time(error);
+            if (error) continue;
+
+            auto [known, inserted] = m_writeTimes.try_emplace(entry.path().string(), writeTime);
+            if (!inserted && known->second != writeTime) {
+                known->second = writeTime;
+                markChanged(entry.path());
+            }
+        }
+    }
+}
+#endif
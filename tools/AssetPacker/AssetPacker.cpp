@@ -0,0 +1,150 @@
+// ================================
+// tools/AssetPacker/AssetPacker.cpp - Pack loose resources into one indexed archive
+// ================================
+// Usage: AssetPacker <output.pak> <fileOrDirectory>...
+//
+// Every texture, font and sound found in the inputs (directories are not
+// recursed) is stored under its file name. AssetArchive memory-maps the
+// result and ResourceManager/AudioManager load straight from the mapping.
+#include "Utils/AssetArchiveFormat.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace AssetArchiveFormat;
+
+namespace {
+    struct PackEntry {
+        std::string name;                          // File name only - the lookup key
+        std::filesystem::path path;
+        AssetType type = AssetType::Other;
+        std::uint64_t size = 0;
+    };
+
+    bool classify(const std::filesystem::path& path, AssetType& type) {
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        if (extension == ".png" || extension == ".jpg" || extension == ".bmp") type = AssetType::Texture;
+        else if (extension == ".ttf" || extension == ".otf") type = AssetType::Font;
+        else if (extension == ".wav") type = AssetType::Sound;
+        else if (extension == ".ogg") type = AssetType::Music;
+        else return false;                         // Configs, videos etc. stay loose
+        return true;
+    }
+
+    void addFile(const std::filesystem::path& path, std::vector<PackEntry>& entries) {
+        PackEntry entry;
+        if (!classify(path, entry.type)) return;
+
+        entry.name = path.filename().string();
+        entry.path = path;
+        entry.size = std::filesystem::file_size(path);
+
+        auto duplicate = std::find_if(entries.begin(), entries.end(),
+            [&entry](const PackEntry& other) { return other.name == entry.name; });
+        if (duplicate != entries.end()) {
+            std::cerr << "AssetPacker: " << path.string() << " duplicates " << duplicate->path.string() << ", skipped" << std::endl;
+            return;
+        }
+        entries.push_back(std::move(entry));
+    }
+
+    std::uint64_t alignUp(std::uint64_t value) {
+        return (value + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: AssetPacker <output.pak> <fileOrDirectory>..." << std::endl;
+        return 1;
+    }
+
+    std::vector<PackEntry> entries;
+    try {
+        for (int i = 2; i < argc; ++i) {
+            std::filesystem::path input = argv[i];
+            if (std::filesystem::is_directory(input)) {
+                for (const auto& item : std::filesystem::directory_iterator(input)) {
+                    if (item.is_regular_file()) addFile(item.path(), entries);
+                }
+            }
+            else if (std::filesystem::is_regular_file(input)) {
+                addFile(input, entries);
+            }
+            else {
+                std::cerr << "AssetPacker: " << input.string() << " not found, skipped" << std::endl;
+            }
+        }
+    }
+    catch (const std::filesystem::filesystem_error& e) {
+        std::cerr << "AssetPacker: " << e.what() << std::endl;
+        return 1;
+    }
+
+    // Sorted index allows binary search at runtime
+    std::sort(entries.begin(), entries.end(),
+        [](const PackEntry& a, const PackEntry& b) { return std::strcmp(a.name.c_str(), b.name.c_str()) < 0; });
+
+    std::string names;
+    std::vector<Entry> index(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        index[i].nameOffset = static_cast<std::uint32_t>(names.size());
+        index[i].type = entries[i].type;
+        index[i].size = entries[i].size;
+        names.append(entries[i].name).push_back('\0');
+    }
+    if (names.empty()) names.push_back('\0');
+
+    std::uint64_t offset = alignUp(sizeof(Header) + index.size() * sizeof(Entry) + names.size());
+    for (auto& entry : index) {
+        entry.offset = offset;
+        offset = alignUp(offset + entry.size);
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.entryCount = static_cast<std::uint32_t>(index.size());
+    header.nameBytes = static_cast<std::uint32_t>(names.size());
+
+    std::ofstream out(argv[1], std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "AssetPacker: cannot write " << argv[1] << std::endl;
+        return 1;
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(Entry)));
+    out.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    std::vector<char> buffer;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        std::uint64_t position = static_cast<std::uint64_t>(out.tellp());
+        out.write(std::string(static_cast<size_t>(index[i].offset - position), '\0').data(),
+            static_cast<std::streamsize>(index[i].offset - position));
+
+        std::ifstream in(entries[i].path, std::ios::binary);
+        buffer.resize(static_cast<size_t>(entries[i].size));
+        if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            std::cerr << "AssetPacker: cannot read " << entries[i].path.string() << std::endl;
+            return 1;
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    if (!out) {
+        std::cerr << "AssetPacker: write to " << argv[1] << " failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "AssetPacker: packed " << entries.size() << " assets into " << argv[1] << std::endl;
+    return 0;
+}
@@ -0,0 +1,253 @@
+// ================================
+// tools/AtlasPacker/AtlasPacker.cpp - Offline Sprite Sheet Atlas Packer
+// ================================
+// Usage: AtlasPacker <manifest.cfg> <resourceDir> <outputDir> <atlasName> [maxPageSize]
+//
+// Packs every sheet listed in the manifest into power-of-two atlas pages
+// (<atlasName>_<n>.png) and writes <atlasName>.atlas describing the page
+// and frame rectangles of each sheet. ResourceManager::loadAtlas reads it.
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr unsigned PADDING = 2;                // Gap between regions to avoid filtering bleed
+    constexpr unsigned DEFAULT_MAX_PAGE_SIZE = 2048;
+
+    struct SheetEntry {
+        std::string path;                          // Path relative to resource dir
+        std::string name;                          // Region name (file name only)
+        int frameCount = 1;
+        int frameWidth = 0;
+        int frameHeight = 0;
+        sf::Image image;
+        sf::Vector2u regionSize;                   // Max of sheet size and frame grid size
+        int page = -1;
+        sf::Vector2u position;
+    };
+
+    struct Shelf {
+        unsigned y = 0;
+        unsigned height = 0;
+        unsigned nextX = 0;
+    };
+
+    struct Page {
+        std::vector<Shelf> shelves;
+        unsigned nextShelfY = 0;
+        unsigned usedWidth = 0;
+        unsigned usedHeight = 0;
+    };
+
+    std::string trim(const std::string& str) {
+        size_t first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+        size_t last = str.find_last_not_of(" \t\r\n");
+        return str.substr(first, last - first + 1);
+    }
+
+    unsigned nextPowerOfTwo(unsigned value) {
+        unsigned result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    // Parse the INI-style manifest (same format as the game's .cfg files)
+    bool parseManifest(const std::string& filename, std::vector<SheetEntry>& entries) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "AtlasPacker: cannot open manifest " << filename << std::endl;
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            line = trim(line);
+            if (line.empty() || line[0] == '#' || line[0] == ';') continue;
+
+            if (line.front() == '[' && line.back() == ']') {
+                SheetEntry entry;
+                entry.path = trim(line.substr(1, line.size() - 2));
+                entry.name = std::filesystem::path(entry.path).filename().string();
+                entries.push_back(entry);
+                continue;
+            }
+
+            size_t equalPos = line.find('=');
+            if (equalPos == std::string::npos || entries.empty()) continue;
+
+            std::string key = trim(line.substr(0, equalPos));
+            int value = 0;
+            try {
+                value = std::stoi(trim(line.substr(equalPos + 1)));
+            }
+            catch (const std::exception&) {
+                std::cerr << "AtlasPacker: bad value for " << key << " in " << entries.back().path << std::endl;
+                return false;
+            }
+
+            if (key == "frames") entries.back().frameCount = std::max(1, value);
+            else if (key == "frameWidth") entries.back().frameWidth = value;
+            else if (key == "frameHeight") entries.back().frameHeight = value;
+        }
+        return true;
+    }
+
+    // Place a region on a page using shelf packing; returns false if it does not fit
+    bool placeOnPage(Page& page, SheetEntry& entry, unsigned maxSize) {
+        unsigned width = entry.regionSize.x + PADDING;
+        unsigned height = entry.regionSize.y + PADDING;
+
+        for (auto& shelf : page.shelves) {
+            if (height <= shelf.height && shelf.nextX + width <= maxSize) {
+                entry.position = { shelf.nextX, shelf.y };
+                shelf.nextX += width;
+                page.usedWidth = std::max(page.usedWidth, shelf.nextX);
+                return true;
+            }
+        }
+
+        if (page.nextShelfY + height > maxSize || width > maxSize) {
+            return false;
+        }
+
+        Shelf shelf{ page.nextShelfY, height, width };
+        page.shelves.push_back(shelf);
+        entry.position = { 0, shelf.y };
+        page.nextShelfY += height;
+        page.usedWidth = std::max(page.usedWidth, width);
+        page.usedHeight = page.nextShelfY;
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 5) {
+        std::cerr << "Usage: AtlasPacker <manifest.cfg> <resourceDir> <outputDir> <atlasName> [maxPageSize]" << std::endl;
+        return 1;
+    }
+
+    const std::filesystem::path resourceDir = argv[2];
+    const std::filesystem::path outputDir = argv[3];
+    const std::string atlasName = argv[4];
+    unsigned maxSize = DEFAULT_MAX_PAGE_SIZE;
+    if (argc > 5) {
+        maxSize = nextPowerOfTwo(static_cast<unsigned>(std::max(1, std::atoi(argv[5]))));
+    }
+
+    std::vector<SheetEntry> entries;
+    if (!parseManifest(argv[1], entries)) {
+        return 1;
+    }
+
+    // Load sheets and resolve frame geometry
+    for (auto& entry : entries) {
+        std::string fullPath = (resourceDir / entry.path).string();
+        if (!entry.image.loadFromFile(fullPath)) {
+            std::cerr << "AtlasPacker: cannot load " << fullPath << std::endl;
+            return 1;
+        }
+
+        sf::Vector2u size = entry.image.getSize();
+        if (entry.frameWidth <= 0) entry.frameWidth = static_cast<int>(size.x) / entry.frameCount;
+        if (entry.frameHeight <= 0) entry.frameHeight = static_cast<int>(size.y);
+
+        // Frames laid out on a grid, exactly like Animation's constructor
+        int framesPerRow = std::max(1, static_cast<int>(size.x) / entry.frameWidth);
+        int rows = (entry.frameCount + framesPerRow - 1) / framesPerRow;
+        unsigned gridWidth = static_cast<unsigned>(std::min(entry.frameCount, framesPerRow) * entry.frameWidth);
+        unsigned gridHeight = static_cast<unsigned>(rows * entry.frameHeight);
+
+        entry.regionSize = { std::max(size.x, gridWidth), std::max(size.y, gridHeight) };
+        if (entry.regionSize.x + PADDING > maxSize || entry.regionSize.y + PADDING > maxSize) {
+            std::cerr << "AtlasPacker: " << entry.path << " is larger than page size " << maxSize << std::endl;
+            return 1;
+        }
+    }
+
+    // Tallest first keeps shelves tight
+    std::vector<SheetEntry*> order;
+    for (auto& entry : entries) order.push_back(&entry);
+    std::stable_sort(order.begin(), order.end(), [](const SheetEntry* a, const SheetEntry* b) {
+        return a->regionSize.y > b->regionSize.y;
+        });
+
+    std::vector<Page> pages;
+    for (SheetEntry* entry : order) {
+        bool placed = false;
+        for (size_t i = 0; i < pages.size() && !placed; ++i) {
+            if (placeOnPage(pages[i], *entry, maxSize)) {
+                entry->page = static_cast<int>(i);
+                placed = true;
+            }
+        }
+        if (!placed) {
+            pages.emplace_back();
+            placeOnPage(pages.back(), *entry, maxSize);
+            entry->page = static_cast<int>(pages.size() - 1);
+        }
+    }
+
+    std::filesystem::create_directories(outputDir);
+
+    // Compose and save power-of-two pages
+    std::vector<std::string> pageFiles;
+    for (size_t i = 0; i < pages.size(); ++i) {
+        unsigned width = nextPowerOfTwo(pages[i].usedWidth);
+        unsigned height = nextPowerOfTwo(pages[i].usedHeight);
+
+        sf::Image pageImage;
+        pageImage.create(width, height, sf::Color::Transparent);
+        for (const auto& entry : entries) {
+            if (entry.page == static_cast<int>(i)) {
+                pageImage.copy(entry.image, entry.position.x, entry.position.y);
+            }
+        }
+
+        std::string pageFile = atlasName + "_" + std::to_string(i) + ".png";
+        if (!pageImage.saveToFile((outputDir / pageFile).string())) {
+            std::cerr << "AtlasPacker: cannot write " << pageFile << std::endl;
+            return 1;
+        }
+        pageFiles.push_back(pageFile);
+        std::cout << "AtlasPacker: " << pageFile << " " << width << "x" << height << std::endl;
+    }
+
+    // Write metadata in the game's .cfg format
+    std::ofstream meta(outputDir / (atlasName + ".atlas"));
+    if (!meta.is_open()) {
+        std::cerr << "AtlasPacker: cannot write " << atlasName << ".atlas" << std::endl;
+        return 1;
+    }
+
+    meta << "# Generated by AtlasPacker - do not edit\n";
+    meta << "[pages]\n";
+    meta << "count=" << pageFiles.size() << "\n";
+    for (size_t i = 0; i < pageFiles.size(); ++i) {
+        meta << "page" << i << "=" << pageFiles[i] << "\n";
+    }
+
+    for (const auto& entry : entries) {
+        sf::Vector2u size = entry.image.getSize();
+        int framesPerRow = std::max(1, static_cast<int>(size.x) / entry.frameWidth);
+
+        meta << "\n[" << entry.name << "]\n";
+        meta << "page=" << entry.page << "\n";
+        meta << "bounds=" << entry.position.x << "," << entry.position.y << ","
+            << entry.regionSize.x << "," << entry.regionSize.y << "\n";
+        meta << "frames=" << entry.frameCount << "\n";
+        for (int f = 0; f < entry.frameCount; ++f) {
+            int x = static_cast<int>(entry.position.x) + (f % framesPerRow) * entry.frameWidth;
+            int y = static_cast<int>(entry.position.y) + (f / framesPerRow) * entry.frameHeight;
+            meta << "frame" << f << "=" << x << "," << y << "," << entry.frameWidth << "," << entry.frameHeight << "\n";
+        }
+    }
+
+    std::cout << "AtlasPacker: packed " << entries.size() << " sheets into " << pageFiles.size() << " page(s)" << std::endl;
+    return 0;
+}